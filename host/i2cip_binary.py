@@ -0,0 +1,182 @@
+"""
+Host-side codec for the I2CIP binary protocol (see src/binary.h).
+
+Frame (before COBS; 0x00 delimits frames on the wire):
+    | OP (1) | SEQ (1) | FQA HI | FQA LO | PAYLOAD (0..N) | CRC HI | CRC LO |
+CRC-16/CCITT (poly 0x1021, init 0xFFFF) over OP..PAYLOAD. Values are type-tagged, little-endian.
+
+Usage (pyserial):
+    import serial
+    from i2cip_binary import *
+    port = serial.Serial("/dev/ttyUSB0", 115200, timeout=0.1)
+    port.write(encode_frame(OP_GET, 1, 0x1234))
+    for frame in FrameReader(port.read):
+        print(frame)
+"""
+
+import struct
+
+OP_PING = 0x01
+OP_GET = 0x02
+OP_SET = 0x03
+OP_TREE = 0x04
+OP_STATS = 0x05
+REPLY = 0x80
+OP_TELEMETRY = 0xA0
+OP_ERROR = 0xFF
+
+E_FRAME = 0x01
+E_CRC = 0x02
+E_OP = 0x03
+
+T_NULL, T_BOOL, T_U8, T_U16, T_U32, T_I8, T_I16, T_I32, T_F32, T_STR = range(10)
+
+_FORMATS = {T_BOOL: "<?", T_U8: "<B", T_U16: "<H", T_U32: "<I", T_I8: "<b", T_I16: "<h", T_I32: "<i", T_F32: "<f"}
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_index, run = 0, 1
+    for byte in data:
+        if byte == 0:
+            out[code_index] = run
+            code_index, run = len(out), 1
+            out.append(0)
+        else:
+            out.append(byte)
+            run += 1
+            if run == 0xFF:
+                out[code_index] = run
+                code_index, run = len(out), 1
+                out.append(0)
+    out[code_index] = run
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            raise ValueError("malformed COBS")
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_value(value, type_=None):
+    """Type-tag a Python value. Defaults: bool -> BOOL, int -> I32, float -> F32, str -> STR, None -> NULL."""
+    if type_ is None:
+        if value is None:
+            type_ = T_NULL
+        elif isinstance(value, bool):
+            type_ = T_BOOL
+        elif isinstance(value, int):
+            type_ = T_I32
+        elif isinstance(value, float):
+            type_ = T_F32
+        else:
+            type_ = T_STR
+    if type_ == T_NULL:
+        return bytes([T_NULL])
+    if type_ == T_STR:
+        raw = (value.encode() if isinstance(value, str) else bytes(value))[:255]  # Truncated, as the firmware's _putValue
+        return bytes([T_STR, len(raw)]) + raw
+    return bytes([type_]) + struct.pack(_FORMATS[type_], value)
+
+
+def decode_values(payload):
+    """Decode every TLV in a payload into a list of Python values."""
+    values, i = [], 0
+    while i < len(payload):
+        type_ = payload[i]
+        i += 1
+        if type_ == T_NULL:
+            values.append(None)
+        elif type_ == T_STR:
+            n = payload[i]
+            values.append(payload[i + 1:i + 1 + n].decode(errors="replace"))
+            i += 1 + n
+        elif type_ in _FORMATS:
+            size = struct.calcsize(_FORMATS[type_])
+            values.append(struct.unpack(_FORMATS[type_], payload[i:i + size])[0])
+            i += size
+        else:
+            raise ValueError("unknown type tag 0x%02X" % type_)
+    return values
+
+
+def encode_frame(op, seq, fqa, payload=b""):
+    raw = bytes([op, seq & 0xFF, (fqa >> 8) & 0xFF, fqa & 0xFF]) + bytes(payload)
+    crc = crc16(raw)
+    return cobs_encode(raw + bytes([crc >> 8, crc & 0xFF])) + b"\x00"
+
+
+def decode_frame(encoded):
+    """Decode one frame (without its 0x00 delimiter) into a dict."""
+    raw = cobs_decode(encoded)
+    if len(raw) < 6:
+        raise ValueError("short frame")
+    if crc16(raw[:-2]) != ((raw[-2] << 8) | raw[-1]):
+        raise ValueError("CRC mismatch")
+    op, seq, fqa, payload = raw[0], raw[1], (raw[2] << 8) | raw[3], raw[4:-2]
+    frame = {"op": op, "seq": seq, "fqa": fqa}
+    if op == OP_ERROR:
+        frame["error"] = payload[0] if payload else None
+    elif op in (OP_PING | REPLY, OP_GET | REPLY, OP_SET | REPLY) or (op == OP_TREE | REPLY and fqa == 0xFFFF):
+        frame["errlev"] = payload[0]
+        frame["values"] = decode_values(payload[1:])
+    else:
+        frame["values"] = decode_values(payload)
+    return frame
+
+
+def ping(seq, fqa):
+    return encode_frame(OP_PING, seq, fqa)
+
+
+def get(seq, fqa, args=None, args_type=None):
+    return encode_frame(OP_GET, seq, fqa, b"" if args is None else encode_value(args, args_type))
+
+
+def set(seq, fqa, value, args=None, value_type=None, args_type=None):
+    payload = encode_value(value, value_type)
+    if args is not None:
+        payload += encode_value(args, args_type)
+    return encode_frame(OP_SET, seq, fqa, payload)
+
+
+class FrameReader:
+    """Split a byte stream into decoded frames. `read` is a callable returning bytes (e.g. serial.Serial.read)."""
+
+    def __init__(self, read, size=64):
+        self.read, self.size, self.buffer = read, size, bytearray()
+
+    def __iter__(self):
+        while True:
+            chunk = self.read(self.size)
+            if not chunk:
+                return
+            self.buffer += chunk
+            while b"\x00" in self.buffer:
+                encoded, _, rest = bytes(self.buffer).partition(b"\x00")
+                self.buffer = bytearray(rest)
+                if not encoded:
+                    continue
+                try:
+                    yield decode_frame(encoded)
+                except ValueError as e:
+                    yield {"op": None, "error": str(e)}
@@ -0,0 +1,64 @@
+"""
+Host-side formatter for I2CIP trace dumps (see src/trace.h).
+
+The device answers {"trace":true} with one line:
+    {"type":"trace","timestamp":MS,"lost":N,"data":[[US, EVENT, FQA, ARG], ...]}
+This prints one line per event, with the time relative to the first event and the FQA split into segments.
+
+Usage:
+    python3 i2cip_trace.py < capture.jsonl
+"""
+
+import json
+import sys
+
+EVENTS = {
+    0x01: "DEVICE_GET",
+    0x02: "DEVICE_SET",
+    0x03: "DEVICE_SETTLE",
+    0x04: "DEVICE_PING",
+    0x10: "MUX_SET",
+    0x11: "MUX_RESET",
+    0x12: "MUX_FAIL",
+    0x20: "BST_INSERT",
+    0x21: "BST_REMOVE",
+    0x22: "HASHTABLE_SET",
+    0x23: "HASHTABLE_REMOVE",
+    0x30: "MODULE_DISCOVER",
+    0x31: "RECOVERY",
+}
+
+ERRLEV = {0: "NONE", 1: "SOFT", 2: "HARD"}
+
+
+def fqa_to_string(fqa):
+    return "%d:%d:%d:0x%02X" % ((fqa >> 13) & 0x7, (fqa >> 10) & 0x7, (fqa >> 7) & 0x7, fqa & 0x7F)
+
+
+def event_name(event):
+    if event >= 0x80:
+        return "USER_%02X" % event
+    return EVENTS.get(event, "0x%02X" % event)
+
+
+def format_trace(message):
+    lines = []
+    data = message.get("data", [])
+    if message.get("lost"):
+        lines.append("(%d older events lost)" % message["lost"])
+    base = data[0][0] if data else 0
+    for time, event, fqa, arg in data:
+        name = event_name(event)
+        detail = ERRLEV.get(arg, arg) if name in ("DEVICE_SETTLE", "DEVICE_PING", "MUX_FAIL") else arg
+        lines.append("%+10dus  %-16s %s  %s" % ((time - base) & 0xFFFFFFFF, name, fqa_to_string(fqa), detail))
+    return lines
+
+
+if __name__ == "__main__":
+    for line in sys.stdin:
+        try:
+            message = json.loads(line)
+        except ValueError:
+            continue
+        if isinstance(message, dict) and message.get("type") == "trace":
+            print("\n".join(format_trace(message)))
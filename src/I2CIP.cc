@@ -215,11 +215,94 @@ bool JsonModule::parseEEPROMContents(const char* buffer) {
   return true;
 }
 
+typedef struct {
+  uint8_t index;        // Position in the request
+  Device* device;
+  DeviceGroup* group;
+  i2cip_args_io_t args;
+  bool doSet;
+  bool doGet;
+} i2cip_batch_entry_t;
+
+// Run one batched command (its bus already held) and fill in its result
+struct _batch_run_t {
+  JsonArray data;
+  i2cip_errorlevel_t operator()(i2cip_batch_entry_t& e, i2cip_errorlevel_t held) {
+    JsonObject result = this->data[e.index];
+    i2cip_errorlevel_t errlev = held;
+    if(errlev == I2CIP_ERR_NONE && e.doSet) {
+      errlev = e.device->set(e.args.s, e.args.b);
+      #ifdef I2CIP_OUTPUTS_USE_TOSTRING
+        if(errlev == I2CIP_ERR_NONE) result["value"] = e.device->getOutput()->valueToString();
+      #endif
+    }
+    if(errlev == I2CIP_ERR_NONE && e.doGet) {
+      errlev = e.device->get(e.args.a);
+      #ifdef I2CIP_INPUTS_USE_TOSTRING
+        if(errlev == I2CIP_ERR_NONE) result["cache"] = e.device->getInput()->cacheToString();
+      #endif
+    }
+    if(errlev == I2CIP_ERR_NONE && !e.doSet && !e.doGet) errlev = e.device->pingTimeout(true, false);
+    result["errlev"] = errlev;
+    return errlev;
+  }
+};
+
+void I2CIP::batchRouter(JsonArray commands, Print& out) {
+  JsonDocument doc;
+  doc["type"] = "batch";
+  doc["timestamp"] = millis();
+  JsonArray data = doc["data"].to<JsonArray>();
+
+  StaticArena<I2CIP_BATCH_ARENA_SIZE> arena;
+  i2cip_batch_entry_t entries[I2CIP_BATCH_MAX];
+  uint8_t count = 0;
+
+  // 1. Resolve devices and parse arguments; results are pre-allocated in request order
+  uint8_t index = 0;
+  for(JsonObject command : commands) {
+    JsonObject result = data.add<JsonObject>();
+    result["fqa"] = command["fqa"];
+    if(index++ >= I2CIP_BATCH_MAX) { result["errlev"] = I2CIP_ERR_SOFT; result["msg"] = "ENOSPC"; continue; }
+
+    i2cip_fqa_t fqa = command["fqa"].as<i2cip_fqa_t>();
+    Device** dptr = command["fqa"].is<int>() ? I2CIP::devicetree[fqa] : nullptr;
+    uint8_t m = (fqa == I2CIP::sevenSegmentFQA) ? 0 : I2CIP_FQA_SEG_MODULE(fqa);
+    if(dptr == nullptr || *dptr == nullptr || m >= I2CIP_MUX_COUNT || I2CIP::modules[m] == nullptr) { result["errlev"] = I2CIP_ERR_SOFT; result["msg"] = "DEVICE ENOENT"; continue; }
+    DeviceGroup* dg = I2CIP::modules[m]->operator[]((*dptr)->getID());
+    if(dg == nullptr || dg->handler == nullptr) { result["errlev"] = I2CIP_ERR_SOFT; result["msg"] = "LIBRARY ENOENT"; continue; }
+
+    i2cip_batch_entry_t e = { (uint8_t)(index - 1), *dptr, dg, _i2cip_args_io_default, false, false };
+    e.args.arena = &arena;
+    dg->handler(e.args, command["a"], command["s"], command["b"]);
+    e.doSet = (e.device->getOutput() != nullptr && !command["s"].isNull());
+    e.doGet = (e.device->getInput() != nullptr && !command["g"].isNull());
+    result["id"] = e.device->getID();
+
+    Runs::insert(entries, count, e); // Sorted by FQA, so each bus is one contiguous run
+  }
+
+  // 2. One pass, one bus selection per run; a failed command doesn't stop the rest
+  _batch_run_t run = { data };
+  Runs::walk(entries, count, run);
+
+  // 3. Release arguments (arena-backed ones in O(1) when `arena` leaves scope)
+  for(uint8_t j = 0; j < count; j++) {
+    if(entries[j].group->cleanup != nullptr) entries[j].group->cleanup(entries[j].args);
+  }
+
+  DebugJson::jsonPrintln(doc, out);
+}
+
 void I2CIP::commandRouter(JsonObject command, Print& out) {
   // if(command.containsKey("rebuild") {
-  if(command["rebuild"].is<bool>()) {
+  if(command["batch"].is<JsonArray>()) {
+    // Many device commands, one pass, one response
+    I2CIP::batchRouter(command["batch"].as<JsonArray>(), out);
+  } else if(command["rebuild"].is<bool>()) {
     // Rebuild device tree
     bool update = command["rebuild"].as<bool>();
+    uint8_t module = command["module"].is<int>() ? (uint8_t)command["module"].as<int>() : I2CIP_MUX_COUNT; // Paginate: one module at a time
 
     #ifdef I2CIP_DEBUG_SERIAL
       DEBUG_DELAY();
@@ -227,7 +310,61 @@ void I2CIP::commandRouter(JsonObject command, Print& out) {
       DEBUG_DELAY();
     #endif
 
-    I2CIP::rebuildTree(out, update);
+    I2CIP::rebuildTree(out, update, module);
+  } else if(command["pools"].is<bool>()) {
+    // Report Device pool usage and high-water marks
+    JsonDocument doc;
+    doc["type"] = "pools";
+    doc["timestamp"] = millis();
+    JsonArray arr = doc["data"].to<JsonArray>();
+    PoolBase::toJSON(arr);
+    DebugJson::jsonPrintln(doc, out);
+  } else if(command["stats"].is<bool>()) {
+    // Report library-wide I/O statistics
+    JsonDocument doc;
+    doc["type"] = "stats";
+    doc["timestamp"] = millis();
+    JsonObject data = doc["data"].to<JsonObject>();
+    data["verified"] = Device::getTotalVerified();
+    data["skipped"] = Device::getTotalSkipped();
+    #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+      data["suppressed"] = OutputSetter::getTotalSuppressed();
+    #endif
+    JsonArray clocks = data["clock"].to<JsonArray>();
+    for(uint8_t w = 0; w < I2CIP_NUM_WIRES; w++) { clocks.add(Clock::get(w)); }
+    #ifdef I2CIP_WIRES_USE_RECOVERY
+      JsonArray recovery = data["recovery"].to<JsonArray>();
+      for(uint8_t w = 0; w < I2CIP_NUM_WIRES; w++) {
+        JsonObject r = recovery.add<JsonObject>();
+        r["attempts"] = Recovery::stats(w).attempts;
+        r["recovered"] = Recovery::stats(w).recovered;
+      }
+    #endif
+    #ifdef I2CIP_OUTPUT_USE_SINK
+      if(OutputSink::getInstance() != nullptr) OutputSink::getInstance()->toJSON(data["sink"].to<JsonObject>());
+    #endif
+    DebugJson::jsonPrintln(doc, out);
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+  } else if(command["stats"].is<int>()) {
+    // Report one device's latency histograms and jitter; `"reset": true` clears them after
+    int i = command["stats"].as<int>();
+    Device** d = (i < 0) ? nullptr : I2CIP::devicetree[(i2cip_fqa_t)i];
+    if(d == nullptr || *d == nullptr) return;
+    JsonDocument doc;
+    doc["type"] = "stats";
+    doc["timestamp"] = millis();
+    doc["fqa"] = (*d)->getFQA();
+    doc["id"] = (*d)->getID();
+    (*d)->latencyToJSON(doc["data"].to<JsonObject>());
+    DebugJson::jsonPrintln(doc, out);
+    if(command["reset"].is<bool>() && command["reset"].as<bool>()) (*d)->resetLatency();
+  #endif
+  #ifdef I2CIP_USE_TRACE
+  } else if(command["trace"].is<bool>()) {
+    // Dump (and clear) the trace ring, or just clear it
+    if(command["trace"].as<bool>()) Trace::dump(out);
+    else Trace::clear();
+  #endif
   } else if(command["fqa"].is<int>()) {
     int i = command["fqa"].as<int>();
     if(i < 0) {
@@ -250,16 +387,34 @@ void I2CIP::commandRouter(JsonObject command, Print& out) {
   }
 }
 
-void I2CIP::rebuildTree(Print& out, bool update) {
-  JsonDocument tree;
-  tree["type"] = "tree";
-  tree["timestamp"] = millis();
-  JsonArray arr = tree["data"].to<JsonArray>();
-  for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
-    JsonObject obj = arr.add<JsonObject>();
-    if(I2CIP::modules[m] != nullptr) {
-      I2CIP::modules[m]->toJSON(obj, update);
+void I2CIP::rebuildTree(Print& out, bool update, uint8_t module) {
+  JsonStream json(out);
+  json.beginObject();
+  json.member("type", "tree");
+  json.member("timestamp", millis());
+  if(module < I2CIP_MUX_COUNT) {
+    // One page: this module's object, and where the next one is
+    json.member("module", module);
+    uint8_t next = module + 1;
+    while(next < I2CIP_MUX_COUNT && I2CIP::modules[next] == nullptr) next++;
+    json.key("next");
+    if(next < I2CIP_MUX_COUNT) json.value(next);
+    else json.null();
+    json.key("data");
+    if(I2CIP::modules[module] != nullptr) I2CIP::modules[module]->toJSON(json, update);
+    else json.null();
+  } else {
+    json.key("data").beginArray();
+    for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
+      if(I2CIP::modules[m] != nullptr) {
+        I2CIP::modules[m]->toJSON(json, update);
+      } else {
+        json.beginObject();
+        json.endObject();
+      }
     }
+    json.endArray();
   }
-  DebugJson::jsonPrintln(tree, out);
+  json.endObject();
+  json.end();
 }
\ No newline at end of file
@@ -11,14 +11,30 @@
 
 #include "device.h"
 #include "interface.h"
+#include "regmap.h"
 #include "eeprom.h"
 
 #include "bst.h"
 #include "hashtable.h"
 #include "module.h"
+#include "snapshot.h"
+#include "presence.h"
+#include "recovery.h"
+#include "binary.h"
+#include "stage.h"
+#include "telemetry.h"
+#include "sink.h"
+#include "trace.h"
 
 #define I2CIP_REVISION 0
 
+#ifdef __AVR__
+#define I2CIP_BATCH_MAX 8         // Max commands per `{"batch":[...]}`
+#else
+#define I2CIP_BATCH_MAX 32
+#endif
+#define I2CIP_BATCH_ARENA_SIZE (I2CIP_ARGS_ARENA_SIZE * 4) // Argument arena shared by every command in a batch
+
 namespace I2CIP {
 
   class JsonModule : public Module {
@@ -33,7 +49,22 @@ namespace I2CIP {
   };
 
   void commandRouter(JsonObject command, Print& out);
-  void rebuildTree(Print& out, bool update = false);
+
+  /**
+   * Batched commands: `{"batch":[{"fqa","g","a","s","b"}, ...]}`.
+   * Commands are run in one pass sorted by FQA, holding each (wire, MUX, bus) selected across its run (see `MUX::hold()`); per command, output `s`/`b` is set before input `g`/`a` is read.
+   * Answers once: `{"type":"batch","timestamp","data":[{"fqa","id","errlev","value"?,"cache"?}, ...]}` in request order. Commands past `I2CIP_BATCH_MAX` are answered `ENOSPC`.
+   */
+  void batchRouter(JsonArray commands, Print& out);
+
+  /**
+   * Stream the device tree as `{"type":"tree","timestamp","data":[{module}, ...]}`, one object per MUX slot, in constant memory.
+   * Paginated: for a single `module`, answers `{"type":"tree","timestamp","module","next","data":{module}}`, where `next` is the next present module (or `null`).
+   * @param out Output to write to
+   * @param update Only include devices that answer a readiness probe (Default: `false`)
+   * @param module Module to describe; `I2CIP_MUX_COUNT` for all (Default)
+   */
+  void rebuildTree(Print& out, bool update = false, uint8_t module = I2CIP_MUX_COUNT);
 
   const i2cip_fqa_t sevenSegmentFQA = createFQA(0, I2CIP_MUX_NUM_FAKE, I2CIP_MUX_BUS_FAKE, 119);
 
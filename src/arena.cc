@@ -0,0 +1,17 @@
+#include "arena.h"
+
+using namespace I2CIP;
+
+void* Arena::allocate(size_t size, size_t align) {
+  if(align == 0) align = 1;
+  uintptr_t start = (uintptr_t)(this->base + this->used);
+  uintptr_t aligned = (start + (align - 1)) & ~(uintptr_t)(align - 1);
+  size_t end = (size_t)(aligned - (uintptr_t)this->base) + size;
+  if(end > this->capacity) {
+    this->overflows++;
+    return nullptr;
+  }
+  this->used = end;
+  if(end > this->highwater) this->highwater = end;
+  return (void*)aligned;
+}
@@ -0,0 +1,94 @@
+#ifndef I2CIP_ARENA_H_
+#define I2CIP_ARENA_H_
+
+#include <type_traits>
+
+#include <Arduino.h>
+
+#ifdef __AVR__
+#include <new.h>
+#else
+#include <new>
+#endif
+
+// ---------------------------------------
+// ARENA: Per-Command Bump Allocation
+// ---------------------------------------
+// JSON argument handlers (`parseJSONArgs`) build typed argument objects behind `i2cip_args_io_t`'s `void*` fields.
+// When the caller attaches an Arena to the args, those objects are bump-allocated from it and the whole lot is released in O(1)
+// by `reset()` (or the arena going out of scope) once the command is done; `deleteArgs` only runs destructors for them.
+// Without an arena, or once it is full, allocation falls back to the heap (and is counted), so handlers work either way.
+
+#define I2CIP_ARGS_ARENA_SIZE 128 // Bytes per command (Default)
+
+namespace I2CIP {
+
+  class Arena {
+    private:
+      uint8_t* const base;
+      const size_t capacity;
+      size_t used = 0;
+      size_t highwater = 0;
+      uint16_t overflows = 0;
+
+    public:
+      Arena(void* buffer, size_t capacity) : base((uint8_t*)buffer), capacity(capacity) { }
+
+      /**
+       * Bump-allocate.
+       * @return Aligned storage, or `nullptr` if the arena is full (counted as an overflow)
+       */
+      void* allocate(size_t size, size_t align);
+
+      /**
+       * @return `true` if `ptr` lies within this arena
+       */
+      bool owns(const void* ptr) const { return ((const uint8_t*)ptr >= this->base) && ((const uint8_t*)ptr < this->base + this->capacity); }
+
+      /**
+       * Release everything at once. Destructors are not run; see `destroy()`.
+       */
+      void reset(void) { this->used = 0; }
+
+      size_t getUsed(void) const { return this->used; }
+      size_t getCapacity(void) const { return this->capacity; }
+      size_t getHighWater(void) const { return this->highwater; }
+      uint16_t getOverflows(void) const { return this->overflows; }
+
+      /**
+       * Construct a `T` in `arena` if given and not full, else on the heap.
+       */
+      template <class T, class... Args> static T* create(Arena* arena, Args&&... args);
+
+      /**
+       * Destroy an object from `create()`: destructor only if it lives in `arena`, otherwise `delete`.
+       */
+      template <class T> static void destroy(Arena* arena, T* ptr);
+
+      /**
+       * Array variants, e.g. for string buffers. Elements are value-initialized.
+       */
+      template <class T> static T* createArray(Arena* arena, size_t count);
+      template <class T> static void destroyArray(Arena* arena, T* ptr);
+  };
+
+  /**
+   * Arena with its own storage, e.g. on the stack of a command handler.
+   */
+  template <size_t N> class StaticArena : public Arena {
+    private:
+      alignas(8) uint8_t storage[N];
+    public:
+      StaticArena(void) : Arena(storage, N) { }
+  };
+};
+
+// Argument marshalling helpers for `parseJSONArgs`/`deleteArgs`; use the arena attached to ARGS (if any)
+#define I2CIP_ARGS_NEW(ARGS, TYPE, ...) (I2CIP::Arena::create<TYPE>((ARGS).arena __VA_OPT__(,) __VA_ARGS__))
+#define I2CIP_ARGS_DELETE(ARGS, TYPE, PTR) { I2CIP::Arena::destroy<TYPE>((ARGS).arena, (TYPE*)(PTR)); (PTR) = nullptr; }
+#define I2CIP_ARGS_NEW_ARRAY(ARGS, TYPE, COUNT) (I2CIP::Arena::createArray<TYPE>((ARGS).arena, (COUNT)))
+#define I2CIP_ARGS_DELETE_ARRAY(ARGS, TYPE, PTR) { I2CIP::Arena::destroyArray<TYPE>((ARGS).arena, (TYPE*)(PTR)); (PTR) = nullptr; }
+
+#include "arena.tpp"
+
+#endif
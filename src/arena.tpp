@@ -0,0 +1,39 @@
+#ifndef I2CIP_ARENA_H_
+#error __FILE__ should only be included AFTER <arena.h>
+#endif
+
+#ifdef I2CIP_ARENA_H_
+
+#ifndef I2CIP_ARENA_T_
+#define I2CIP_ARENA_T_
+
+template <class T, class... Args> T* I2CIP::Arena::create(Arena* arena, Args&&... args) {
+  void* slot = (arena == nullptr) ? nullptr : arena->allocate(sizeof(T), alignof(T));
+  if(slot == nullptr) return new T(static_cast<Args&&>(args)...);
+  return new (slot) T(static_cast<Args&&>(args)...);
+}
+
+template <class T> void I2CIP::Arena::destroy(Arena* arena, T* ptr) {
+  if(ptr == nullptr) return;
+  if(arena != nullptr && arena->owns(ptr)) { ptr->~T(); return; }
+  delete ptr;
+}
+
+template <class T> T* I2CIP::Arena::createArray(Arena* arena, size_t count) {
+  static_assert(std::is_trivially_destructible<T>::value, "Arena arrays are released without destructors");
+  void* slot = (arena == nullptr) ? nullptr : arena->allocate(sizeof(T) * count, alignof(T));
+  if(slot == nullptr) return new T[count]();
+  T* arr = (T*)slot;
+  for(size_t i = 0; i < count; i++) { new (&arr[i]) T(); }
+  return arr;
+}
+
+template <class T> void I2CIP::Arena::destroyArray(Arena* arena, T* ptr) {
+  if(ptr == nullptr) return;
+  if(arena != nullptr && arena->owns(ptr)) return; // Released by reset(); array args are plain data
+  delete[] ptr;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+#include "binary.h"
+
+#include <ArduinoJson.h>
+
+#include "I2CIP.hpp"
+#include "topology.h"
+#include "debug_i2cip.h"
+
+using namespace I2CIP;
+
+#define I2CIP_BIN_HEADER 4  // OP, SEQ, FQA HI, FQA LO
+#define I2CIP_BIN_CRC    2
+
+static uint8_t _rx[I2CIP_BINARY_FRAME_MAX + I2CIP_BINARY_FRAME_MAX / 254 + 2]; // Encoded frame accumulator
+static size_t _rxlen = 0;
+static bool _rxoverflow = false;
+
+// TLV helpers
+
+static size_t _putValue(uint8_t* dest, size_t cap, i2cip_bin_type_t type, const void* value, size_t len) {
+  if(type == I2CIP_BIN_STR) {
+    if(cap < 2) return 0;
+    if(len > 255) len = 255;
+    if(len > cap - 2) len = cap - 2; // Truncate to what's left of the frame
+    dest[0] = type; dest[1] = (uint8_t)len;
+    memcpy(dest + 2, value, len);
+    return len + 2;
+  }
+  if(cap < len + 1) return 0;
+  dest[0] = type;
+  // Little-endian on the wire; every supported target is little-endian already
+  memcpy(dest + 1, value, len);
+  return len + 1;
+}
+
+static size_t _putString(uint8_t* dest, size_t cap, const char* str) {
+  return (str == nullptr) ? 0 : _putValue(dest, cap, I2CIP_BIN_STR, str, strlen(str));
+}
+
+static size_t _putU32(uint8_t* dest, size_t cap, uint32_t value) { return _putValue(dest, cap, I2CIP_BIN_U32, &value, 4); }
+
+/**
+ * Decode one TLV into `var`.
+ * @return Bytes consumed, or 0 if truncated/unknown
+ */
+static size_t _getValue(const uint8_t* src, size_t len, JsonVariant var) {
+  if(len < 1) return 0;
+  const uint8_t* v = src + 1;
+  switch((i2cip_bin_type_t)src[0]) {
+    case I2CIP_BIN_NULL: return 1;
+    case I2CIP_BIN_BOOL: if(len < 2) return 0; var.set(v[0] != 0); return 2;
+    case I2CIP_BIN_U8:   if(len < 2) return 0; var.set(v[0]); return 2;
+    case I2CIP_BIN_I8:   if(len < 2) return 0; var.set((int8_t)v[0]); return 2;
+    case I2CIP_BIN_U16:  { if(len < 3) return 0; uint16_t x; memcpy(&x, v, 2); var.set(x); return 3; }
+    case I2CIP_BIN_I16:  { if(len < 3) return 0; int16_t x;  memcpy(&x, v, 2); var.set(x); return 3; }
+    case I2CIP_BIN_U32:  { if(len < 5) return 0; uint32_t x; memcpy(&x, v, 4); var.set(x); return 5; }
+    case I2CIP_BIN_I32:  { if(len < 5) return 0; int32_t x;  memcpy(&x, v, 4); var.set(x); return 5; }
+    case I2CIP_BIN_F32:  { if(len < 5) return 0; float x;    memcpy(&x, v, 4); var.set(x); return 5; }
+    case I2CIP_BIN_STR: {
+      if(len < 2 || len < (size_t)v[0] + 2) return 0;
+      char str[I2CIP_BINARY_FRAME_MAX]; // A string never outlasts its frame
+      if((size_t)v[0] >= sizeof(str)) return 0;
+      memcpy(str, v + 1, v[0]); str[v[0]] = '\0';
+      var.set(str); // Copied into the document
+      return (size_t)v[0] + 2;
+    }
+    default: return 0;
+  }
+}
+
+size_t Binary::cobsEncode(const uint8_t* src, size_t len, uint8_t* dest) {
+  size_t out = 1, code = 0;
+  uint8_t run = 1;
+  for(size_t i = 0; i < len; i++) {
+    if(src[i] == 0) {
+      dest[code] = run; code = out++; run = 1;
+    } else {
+      dest[out++] = src[i];
+      if(++run == 0xFF) { dest[code] = run; code = out++; run = 1; }
+    }
+  }
+  dest[code] = run;
+  return out;
+}
+
+size_t Binary::cobsDecode(uint8_t* buf, size_t len) {
+  size_t in = 0, out = 0;
+  while(in < len) {
+    uint8_t code = buf[in++];
+    if(code == 0 || in + code - 1 > len) return 0;
+    for(uint8_t i = 1; i < code; i++) buf[out++] = buf[in++];
+    if(code != 0xFF && in < len) buf[out++] = 0;
+  }
+  return out;
+}
+
+void Binary::send(Print& out, uint8_t op, uint8_t seq, i2cip_fqa_t fqa, const uint8_t* payload, size_t len) {
+  uint8_t raw[I2CIP_BINARY_FRAME_MAX];
+  if(len > I2CIP_BINARY_FRAME_MAX - I2CIP_BIN_HEADER - I2CIP_BIN_CRC) len = I2CIP_BINARY_FRAME_MAX - I2CIP_BIN_HEADER - I2CIP_BIN_CRC;
+  raw[0] = op; raw[1] = seq; raw[2] = (uint8_t)(fqa >> 8); raw[3] = (uint8_t)(fqa & 0xFF);
+  if(len > 0) memcpy(raw + I2CIP_BIN_HEADER, payload, len);
+  uint16_t crc = crc16(raw, I2CIP_BIN_HEADER + len);
+  raw[I2CIP_BIN_HEADER + len] = (uint8_t)(crc >> 8);
+  raw[I2CIP_BIN_HEADER + len + 1] = (uint8_t)(crc & 0xFF);
+
+  uint8_t encoded[sizeof(raw) + sizeof(raw) / 254 + 2];
+  size_t n = cobsEncode(raw, I2CIP_BIN_HEADER + len + I2CIP_BIN_CRC, encoded);
+  encoded[n++] = 0x00;
+  out.write(encoded, n);
+}
+
+void Binary::telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, float value) {
+  uint8_t payload[10];
+  size_t n = _putU32(payload, sizeof(payload), timestamp);
+  n += _putValue(payload + n, sizeof(payload) - n, I2CIP_BIN_F32, &value, 4);
+  send(out, I2CIP_BIN_OP_TELEMETRY, 0, fqa, payload, n);
+}
+
+void Binary::telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, int32_t value) {
+  uint8_t payload[10];
+  size_t n = _putU32(payload, sizeof(payload), timestamp);
+  n += _putValue(payload + n, sizeof(payload) - n, I2CIP_BIN_I32, &value, 4);
+  send(out, I2CIP_BIN_OP_TELEMETRY, 0, fqa, payload, n);
+}
+
+void Binary::telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, const char* value) {
+  uint8_t payload[I2CIP_BINARY_FRAME_MAX];
+  size_t n = _putU32(payload, sizeof(payload), timestamp);
+  n += _putString(payload + n, sizeof(payload) - n - I2CIP_BIN_HEADER - I2CIP_BIN_CRC, value);
+  send(out, I2CIP_BIN_OP_TELEMETRY, 0, fqa, payload, n);
+}
+
+// Same semantics as the JSON router: resolve the device, marshal args through its group's handler, then set/get/ping
+static void _dispatch(uint8_t op, uint8_t seq, i2cip_fqa_t fqa, const uint8_t* payload, size_t len, Print& out) {
+  uint8_t reply[I2CIP_BINARY_FRAME_MAX];
+  size_t n = 0;
+  const size_t cap = sizeof(reply) - I2CIP_BIN_HEADER - I2CIP_BIN_CRC;
+
+  if(op == I2CIP_BIN_OP_STATS) {
+    n += _putU32(reply + n, cap - n, Device::getTotalVerified());
+    n += _putU32(reply + n, cap - n, Device::getTotalSkipped());
+    #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+      n += _putU32(reply + n, cap - n, OutputSetter::getTotalSuppressed());
+    #else
+      n += _putU32(reply + n, cap - n, 0);
+    #endif
+    Binary::send(out, op | I2CIP_BIN_REPLY, seq, fqa, reply, n);
+    return;
+  }
+
+  if(op == I2CIP_BIN_OP_TREE) {
+    uint16_t size = I2CIP::devicetree.size();
+    for(uint16_t i = 0; i < size; i++) {
+      Device** d = I2CIP::devicetree.getByIndex(i);
+      if(d == nullptr || *d == nullptr) continue;
+      n = _putString(reply, cap, (*d)->getID());
+      Binary::send(out, op | I2CIP_BIN_REPLY, seq, (*d)->getFQA(), reply, n);
+    }
+    reply[0] = I2CIP_ERR_NONE;
+    Binary::send(out, op | I2CIP_BIN_REPLY, seq, (i2cip_fqa_t)(~0), reply, 1);
+    return;
+  }
+
+  if(op != I2CIP_BIN_OP_PING && op != I2CIP_BIN_OP_GET && op != I2CIP_BIN_OP_SET) {
+    reply[0] = I2CIP_BIN_EOP;
+    Binary::send(out, I2CIP_BIN_OP_ERROR, seq, fqa, reply, 1);
+    return;
+  }
+
+  i2cip_errorlevel_t errlev = I2CIP_ERR_SOFT;
+  const char* str = nullptr;
+
+  Device** dptr = I2CIP::devicetree[fqa];
+  uint8_t m = (fqa == I2CIP::sevenSegmentFQA) ? 0 : I2CIP_FQA_SEG_MODULE(fqa);
+  if(dptr != nullptr && *dptr != nullptr && m < I2CIP_MUX_COUNT && I2CIP::modules[m] != nullptr) {
+    Device* d = *dptr;
+    if(op == I2CIP_BIN_OP_PING) {
+      errlev = d->pingTimeout(true, true);
+    } else {
+      DeviceGroup* dg = I2CIP::modules[m]->operator[](d->getID());
+      JsonDocument doc;
+      size_t used = 0;
+      if(op == I2CIP_BIN_OP_SET) {
+        size_t k = _getValue(payload, len, doc["s"].to<JsonVariant>());
+        used = k;
+        if(k > 0 && used < len) used += _getValue(payload + used, len - used, doc["b"].to<JsonVariant>());
+      } else if(len > 0) {
+        used = _getValue(payload, len, doc["a"].to<JsonVariant>());
+      }
+
+      if(dg != nullptr && dg->handler != nullptr && (op != I2CIP_BIN_OP_SET || used > 0)) {
+        StaticArena<I2CIP_ARGS_ARENA_SIZE> arena;
+        i2cip_args_io_t args = _i2cip_args_io_default;
+        args.arena = &arena;
+        dg->handler(args, doc["a"], doc["s"], doc["b"]);
+        if(op == I2CIP_BIN_OP_SET && d->getOutput() != nullptr) {
+          errlev = d->set(args.s, args.b);
+          #ifdef I2CIP_OUTPUTS_USE_TOSTRING
+            if(errlev == I2CIP_ERR_NONE) str = d->getOutput()->valueToString();
+          #endif
+        } else if(op == I2CIP_BIN_OP_GET && d->getInput() != nullptr) {
+          errlev = d->get(args.a);
+          #ifdef I2CIP_INPUTS_USE_TOSTRING
+            if(errlev == I2CIP_ERR_NONE) str = d->getInput()->cacheToString();
+          #endif
+        }
+        if(dg->cleanup != nullptr) dg->cleanup(args);
+      }
+    }
+  }
+
+  reply[n++] = (uint8_t)errlev;
+  if(str != nullptr) n += _putString(reply + n, cap - n, str);
+  Binary::send(out, op | I2CIP_BIN_REPLY, seq, fqa, reply, n);
+}
+
+void Binary::update(Stream& in, Print& out) {
+  while(in.available() > 0) {
+    int c = in.read();
+    if(c < 0) break;
+    if(c != 0x00) {
+      if(_rxlen < sizeof(_rx)) _rx[_rxlen++] = (uint8_t)c;
+      else _rxoverflow = true;
+      continue;
+    }
+
+    // Delimiter: decode and dispatch
+    size_t len = (_rxoverflow || _rxlen == 0) ? 0 : cobsDecode(_rx, _rxlen);
+    bool empty = (_rxlen == 0);
+    _rxlen = 0;
+    _rxoverflow = false;
+    if(empty) continue; // Back-to-back delimiters resync
+
+    uint8_t reason = 0;
+    if(len < I2CIP_BIN_HEADER + I2CIP_BIN_CRC) {
+      reason = I2CIP_BIN_EFRAME;
+    } else if(crc16(_rx, len - I2CIP_BIN_CRC) != (uint16_t)((_rx[len - 2] << 8) | _rx[len - 1])) {
+      reason = I2CIP_BIN_ECRC;
+    }
+    if(reason != 0) {
+      #ifdef I2CIP_DEBUG_SERIAL
+        DEBUG_DELAY();
+        I2CIP_DEBUG_SERIAL.print(F("-> Binary Frame Rejected: "));
+        I2CIP_DEBUG_SERIAL.println(reason);
+        DEBUG_DELAY();
+      #endif
+      send(out, I2CIP_BIN_OP_ERROR, (len >= 2) ? _rx[1] : 0, 0, &reason, 1);
+      continue;
+    }
+
+    i2cip_fqa_t fqa = ((i2cip_fqa_t)_rx[2] << 8) | _rx[3];
+    _dispatch(_rx[0], _rx[1], fqa, _rx + I2CIP_BIN_HEADER, len - I2CIP_BIN_HEADER - I2CIP_BIN_CRC, out);
+  }
+}
@@ -0,0 +1,94 @@
+#ifndef I2CIP_BINARY_H_
+#define I2CIP_BINARY_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+
+// ---------------------------------------
+// BINARY: Framed Binary Command/Telemetry Protocol
+// ---------------------------------------
+// A compact alternative to the DebugJson text protocol, with the same command semantics as `commandRouter`.
+// Frame (before COBS; 0x00 delimits frames on the wire):
+// | OP (1) | SEQ (1) | FQA HI | FQA LO | PAYLOAD (0..N) | CRC HI | CRC LO |
+// CRC is `crc16()` (CCITT, init 0xFFFF) over OP..PAYLOAD. Replies echo SEQ with OP | I2CIP_BIN_REPLY.
+// Payload values are type-tagged and fixed-width (little-endian); see `i2cip_bin_type_t`. A host-side codec is in `host/i2cip_binary.py`.
+
+#ifdef __AVR__
+#define I2CIP_BINARY_FRAME_MAX 48   // Max decoded frame length
+#else
+#define I2CIP_BINARY_FRAME_MAX 255
+#endif
+
+// Host -> Controller
+#define I2CIP_BIN_OP_PING   0x01  // FQA                  -> ERRLEV
+#define I2CIP_BIN_OP_GET    0x02  // FQA, [A]             -> ERRLEV, [CACHE (STR)]
+#define I2CIP_BIN_OP_SET    0x03  // FQA, S, [B]          -> ERRLEV, [VALUE (STR)]
+#define I2CIP_BIN_OP_TREE   0x04  // -                    -> One reply per device: FQA, ID (STR); then ERRLEV with FQA 0xFFFF
+#define I2CIP_BIN_OP_STATS  0x05  // -                    -> VERIFIED (U32), SKIPPED (U32), SUPPRESSED (U32)
+
+// Controller -> Host
+#define I2CIP_BIN_REPLY         0x80  // OR'd into the request OP
+#define I2CIP_BIN_OP_TELEMETRY  0xA0  // FQA, TIMESTAMP (U32), VALUE
+#define I2CIP_BIN_OP_ERROR      0xFF  // Undecodable frame; PAYLOAD: reason (U8)
+
+#define I2CIP_BIN_EFRAME  0x01  // Bad COBS, truncated, or oversized
+#define I2CIP_BIN_ECRC    0x02  // CRC mismatch
+#define I2CIP_BIN_EOP     0x03  // Unknown opcode
+
+namespace I2CIP {
+
+  typedef enum {
+    I2CIP_BIN_NULL  = 0x00,
+    I2CIP_BIN_BOOL  = 0x01,
+    I2CIP_BIN_U8    = 0x02,
+    I2CIP_BIN_U16   = 0x03,
+    I2CIP_BIN_U32   = 0x04,
+    I2CIP_BIN_I8    = 0x05,
+    I2CIP_BIN_I16   = 0x06,
+    I2CIP_BIN_I32   = 0x07,
+    I2CIP_BIN_F32   = 0x08,
+    I2CIP_BIN_STR   = 0x09, // | LEN (1) | BYTES (LEN) |
+  } i2cip_bin_type_t;
+
+  namespace Binary {
+    /**
+     * COBS-encode `len` bytes from `src` into `dest`, without the trailing delimiter.
+     * @param dest At least `len + len / 254 + 1` bytes
+     * @return Encoded length
+     */
+    size_t cobsEncode(const uint8_t* src, size_t len, uint8_t* dest);
+
+    /**
+     * COBS-decode in place.
+     * @return Decoded length, or 0 if malformed
+     */
+    size_t cobsDecode(uint8_t* buf, size_t len);
+
+    /**
+     * Consume bytes from `in`; each complete frame is checked and dispatched, and its reply written to `out`. Non-blocking.
+     * @param in Input stream
+     * @param out Reply stream
+     */
+    void update(Stream& in, Print& out);
+
+    /**
+     * Send one frame.
+     * @param op Opcode
+     * @param seq Sequence number (echo the request's for replies)
+     * @param fqa FQA
+     * @param payload Payload bytes
+     * @param len Payload length
+     */
+    void send(Print& out, uint8_t op, uint8_t seq, i2cip_fqa_t fqa, const uint8_t* payload = nullptr, size_t len = 0);
+
+    /**
+     * Unsolicited telemetry; binary counterparts of `DebugJson::telemetry*`.
+     */
+    void telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, float value);
+    void telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, int32_t value);
+    void telemetry(Print& out, i2cip_fqa_t fqa, uint32_t timestamp, const char* value);
+  };
+};
+
+#endif
@@ -55,6 +55,7 @@ template <typename K, typename T> BSTNode<K,T>* BST<K,T>::insert(K key, T value,
 }
 
 template <typename K, typename T> BSTNode<K,T>* BST<K,T>::insert(K key, T value, bool overwrite) {
+  I2CIP_TRACE(I2CIP_TRACE_BST_INSERT, i2cip_trace_key(key), 0); // Once per operation, not per level
   return insert(key, value, this->root, overwrite);
 }
 
@@ -98,6 +99,7 @@ template <typename K, typename T> BSTNode<K,T>* BST<K,T>::remove(K key, BSTNode<
 }
 
 template <typename K, typename T> BSTNode<K,T>* BST<K,T>::remove(K key) {
+  I2CIP_TRACE(I2CIP_TRACE_BST_REMOVE, i2cip_trace_key(key), 0);
   return remove(key, this->root);
 }
 
@@ -0,0 +1,123 @@
+#include "clock.h"
+
+#include "debug_i2cip.h"
+
+using namespace I2CIP;
+
+static const uint32_t _modes[I2CIP_CLOCK_MODES] = { I2CIP_CLOCK_STANDARD, I2CIP_CLOCK_FAST, I2CIP_CLOCK_FASTPLUS };
+
+static uint8_t _votes[I2CIP_NUM_WIRES][I2CIP_CLOCK_MODES] = { { 0 } }; // Shared segment (whole wire, if no channels)
+static uint32_t _clock[I2CIP_NUM_WIRES] = { 0 }; // Last applied; 0 = never
+
+#ifdef I2CIP_CLOCK_USE_CHANNELS
+static uint8_t _channels[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT][I2CIP_MUX_BUS_COUNT][I2CIP_CLOCK_MODES] = { { { { 0 } } } };
+static uint8_t _active[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT] = { { 0 } }; // Selected bus mask per MUX
+#endif
+
+// Fastest mode not exceeding `hz`
+static uint8_t _mode(uint32_t hz) {
+  uint8_t m = 0;
+  while(m + 1 < I2CIP_CLOCK_MODES && _modes[m + 1] <= hz) m++;
+  return m;
+}
+
+// Slowest mode with votes, or I2CIP_CLOCK_MODES if none
+static uint8_t _slowest(const uint8_t votes[I2CIP_CLOCK_MODES]) {
+  for(uint8_t m = 0; m < I2CIP_CLOCK_MODES; m++) {
+    if(votes[m] > 0) return m;
+  }
+  return I2CIP_CLOCK_MODES;
+}
+
+// Channel votes only; devices on a fake MUX/bus are always connected
+static inline bool _isChannel(const i2cip_fqa_t& fqa) {
+  return I2CIP_FQA_SEG_MODULE(fqa) != I2CIP_MUX_NUM_FAKE && I2CIP_FQA_SEG_MUXBUS(fqa) != I2CIP_MUX_BUS_FAKE;
+}
+
+uint32_t Clock::get(uint8_t wire) {
+  if(wire >= I2CIP_NUM_WIRES) return I2CIP_CLOCK_DEFAULT;
+  uint8_t mode = _slowest(_votes[wire]);
+
+  #ifdef I2CIP_CLOCK_USE_CHANNELS
+    for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
+      uint8_t mask = _active[wire][m];
+      for(uint8_t bus = 0; mask != 0 && bus < I2CIP_MUX_BUS_COUNT; bus++, mask >>= 1) {
+        if(!(mask & 1)) continue;
+        uint8_t c = _slowest(_channels[wire][m][bus]);
+        if(c < mode) mode = c;
+      }
+    }
+  #endif
+
+  return (mode < I2CIP_CLOCK_MODES) ? _modes[mode] : I2CIP_CLOCK_DEFAULT; // Nothing attached
+}
+
+void Clock::apply(uint8_t wire) {
+  if(wire >= I2CIP_NUM_WIRES || !wiresBegun[wire]) return;
+  uint32_t hz = Clock::get(wire);
+  if(hz == _clock[wire]) return;
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> I2C WIRE "));
+    I2CIP_DEBUG_SERIAL.print(wire);
+    I2CIP_DEBUG_SERIAL.print(F(" CLOCK "));
+    I2CIP_DEBUG_SERIAL.print(hz);
+    I2CIP_DEBUG_SERIAL.println(F("Hz"));
+    DEBUG_DELAY();
+  #endif
+
+  wires[wire]->setClock(hz);
+  _clock[wire] = hz;
+}
+
+void Clock::vote(uint8_t wire, uint32_t hz) {
+  if(wire >= I2CIP_NUM_WIRES) return;
+  uint8_t m = _mode(hz);
+  if(_votes[wire][m] < 0xFF) _votes[wire][m]++;
+  Clock::apply(wire);
+}
+
+void Clock::unvote(uint8_t wire, uint32_t hz) {
+  if(wire >= I2CIP_NUM_WIRES) return;
+  uint8_t m = _mode(hz);
+  if(_votes[wire][m] > 0) _votes[wire][m]--;
+  Clock::apply(wire);
+}
+
+void Clock::vote(const i2cip_fqa_t& fqa, uint32_t hz) {
+  uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa);
+  #ifdef I2CIP_CLOCK_USE_CHANNELS
+    if(wire < I2CIP_NUM_WIRES && _isChannel(fqa)) {
+      uint8_t* votes = _channels[wire][I2CIP_FQA_SEG_MODULE(fqa)][I2CIP_FQA_SEG_MUXBUS(fqa)];
+      uint8_t m = _mode(hz);
+      if(votes[m] < 0xFF) votes[m]++;
+      Clock::apply(wire);
+      return;
+    }
+  #endif
+  Clock::vote(wire, hz);
+}
+
+void Clock::unvote(const i2cip_fqa_t& fqa, uint32_t hz) {
+  uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa);
+  #ifdef I2CIP_CLOCK_USE_CHANNELS
+    if(wire < I2CIP_NUM_WIRES && _isChannel(fqa)) {
+      uint8_t* votes = _channels[wire][I2CIP_FQA_SEG_MODULE(fqa)][I2CIP_FQA_SEG_MUXBUS(fqa)];
+      uint8_t m = _mode(hz);
+      if(votes[m] > 0) votes[m]--;
+      Clock::apply(wire);
+      return;
+    }
+  #endif
+  Clock::unvote(wire, hz);
+}
+
+void Clock::select(uint8_t wire, uint8_t module, uint8_t mask) {
+  #ifdef I2CIP_CLOCK_USE_CHANNELS
+    if(wire >= I2CIP_NUM_WIRES || module >= I2CIP_MUX_COUNT) return;
+    if(_active[wire][module] == mask) return; // No change; skip the recompute
+    _active[wire][module] = mask;
+    Clock::apply(wire);
+  #endif
+}
@@ -0,0 +1,74 @@
+#ifndef I2CIP_CLOCK_H_
+#define I2CIP_CLOCK_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+#include "mux.h"
+
+// ----------------------------------
+// CLOCK: Per-Wire SCL Negotiation
+// ----------------------------------
+// Every attached device (and every MUX) votes for the fastest I2C mode it supports. Each wire runs at the slowest vote among its
+// attached parts, and is retuned whenever a vote is added or withdrawn (i.e. devices/modules come and go).
+// Votes are bucketed by bus mode; a part slower than standard mode still votes standard mode.
+//
+// With `I2CIP_CLOCK_USE_CHANNELS`, votes are also kept per MUX channel (wire, module, bus). Devices behind a MUX channel are only
+// connected while it is selected, so the wire runs at the slowest of: the shared segment (MUXes, and devices on a fake MUX/bus),
+// and every channel currently selected. `MUX::setBus()`/`MUX::resetBus()` report selections via `Clock::select()`, which retunes after
+// the MUX write completes: the MUX write itself only reaches the previously-connected segments, so the old clock is always safe for it.
+
+#define I2CIP_CLOCK_STANDARD  100000UL  // Standard-mode (Sm)
+#define I2CIP_CLOCK_FAST      400000UL  // Fast-mode (Fm)
+#define I2CIP_CLOCK_FASTPLUS  1000000UL // Fast-mode Plus (Fm+)
+
+#define I2CIP_CLOCK_DEFAULT   I2CIP_CLOCK_STANDARD  // Device class default, and idle wire clock
+#define I2CIP_MUX_MAX_CLOCK   I2CIP_CLOCK_FAST      // TCA9548A
+
+#define I2CIP_CLOCK_MODES 3
+
+#ifndef __AVR__
+#define I2CIP_CLOCK_USE_CHANNELS true // comment out to negotiate one clock per wire (slowest device anywhere on the wire)
+#endif
+
+namespace I2CIP {
+  namespace Clock {
+    /**
+     * Add a vote on `wire`'s shared segment for a part supporting up to `hz` (e.g. a MUX). Retunes the wire if its clock changes.
+     */
+    void vote(uint8_t wire, uint32_t hz);
+
+    /**
+     * Withdraw a vote previously made with `vote(wire, hz)`.
+     */
+    void unvote(uint8_t wire, uint32_t hz);
+
+    /**
+     * Add a vote for a device at `fqa` supporting up to `hz`; counts toward its MUX channel if `I2CIP_CLOCK_USE_CHANNELS`, else its wire.
+     */
+    void vote(const i2cip_fqa_t& fqa, uint32_t hz);
+
+    /**
+     * Withdraw a vote previously made with `vote(fqa, hz)`.
+     */
+    void unvote(const i2cip_fqa_t& fqa, uint32_t hz);
+
+    /**
+     * Record the channels a MUX now has selected, and retune the wire if needed.
+     * @param mask MUX instruction written (bitmask of selected buses; `I2CIP_MUX_INSTR_RST` after a reset)
+     */
+    void select(uint8_t wire, uint8_t module, uint8_t mask);
+
+    /**
+     * @return Negotiated SCL frequency for `wire` with its currently-selected channels (Hz)
+     */
+    uint32_t get(uint8_t wire);
+
+    /**
+     * Apply the negotiated clock to `wire` (if begun). Called by `beginWire()`.
+     */
+    void apply(uint8_t wire);
+  };
+};
+
+#endif
@@ -36,4 +36,6 @@
 #define _F(x) F(x)
 #endif
 
-#endif
\ No newline at end of file
+#endif
+
+#include "trace.h"
@@ -1,11 +1,19 @@
 #include "device.h"
 
 #include "debug_i2cip.h"
+#include "presence.h"
+#include "recovery.h"
 
 using namespace I2CIP;
 
 // Globals
-i2cip_args_io_t I2CIP::_i2cip_args_io_default = { true, nullptr, nullptr, nullptr };
+i2cip_args_io_t I2CIP::_i2cip_args_io_default = { true, nullptr, nullptr, nullptr, nullptr };
+uint32_t Device::totalVerified = 0;
+uint32_t Device::totalSkipped = 0;
+#ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+uint32_t OutputSetter::totalSuppressed = 0;
+#endif
+i2cip_idle_hook_t Device::idleHook = nullptr;
 
 i2cip_errorlevel_t Device::requestFromRegister(const i2cip_fqa_t& fqa, size_t& len, const uint8_t& reg, bool sendStop) {
   // send internal address; this mode allows sending a repeated start to access
@@ -128,12 +136,28 @@ const char InputGetter::failptr_get;
 const char OutputSetter::failptr_set;
 
 InputGetter::~InputGetter() { 
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+    if(this->bound) Interrupt::unbind(this); // Don't leave a dangling pointer in the ISR table
+  #endif
   // #ifdef I2CIP_DEBUG_SERIAL
   //   DEBUG_DELAY();
   //   I2CIP_DEBUG_SERIAL.print(F("~InputGetter"));
   //   DEBUG_DELAY();
   // #endif
 }
+#ifdef I2CIP_INPUTS_USE_INTERRUPTS
+bool InputGetter::bindInterrupt(uint8_t pin, int mode, unsigned long safety) {
+  this->bound = Interrupt::bind(pin, this, mode);
+  if(this->bound) this->safety = safety;
+  return this->bound;
+}
+
+void InputGetter::unbindInterrupt(void) {
+  Interrupt::unbind(this);
+  this->bound = false;
+}
+#endif
+
 OutputSetter::~OutputSetter() {
   // #ifdef I2CIP_DEBUG_SERIAL
   //   DEBUG_DELAY();
@@ -150,13 +174,83 @@ bool Device::_begin(bool setbus) {
     I2CIP_DEBUG_SERIAL.print("BEGIN ");
   #endif
   this->ready = (this->begin(setbus) == I2CIP_ERR_NONE);
+  this->verifyPending = true;
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    if(this->output != nullptr) this->output->invalidate(); // Device state unknown after (re)begin
+  #endif
   return this->ready;
 }
 
-i2cip_errorlevel_t Device::get(const void* args) { 
+i2cip_errorlevel_t Device::settle(i2cip_errorlevel_t errlev, bool wrote, uint32_t start) {
+  if(errlev != I2CIP_ERR_NONE) {
+    this->ready = false;
+    MUX::resetBus(this->fqa); // Attempt; might be lost
+    this->verifyPending = true;
+    Presence::expedite(this->fqa); // Full module check next tick
+  } else {
+    errlev = this->postVerify(wrote);
+  }
+  #ifdef I2CIP_WIRES_USE_RECOVERY
+    Recovery::report(this->fqa, errlev);
+  #endif
+  I2CIP_TRACE(I2CIP_TRACE_DEVICE_SETTLE, this->fqa, errlev);
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    uint32_t now = micros();
+    this->latency[wrote ? I2CIP_LATENCY_SET : I2CIP_LATENCY_GET].record(now - start);
+    if(!wrote && errlev == I2CIP_ERR_NONE) this->jitter.sample(now);
+  #endif
+  return errlev;
+}
+
+i2cip_errorlevel_t Device::postVerify(bool wrote) {
+  if(MUX::broadcasting(this->fqa)) return I2CIP_ERR_NONE; // Any channel would ACK; the session's end resets the MUX
+
+  bool ping;
+  switch(this->getVerify()) {
+    case I2CIP_VERIFY_ALWAYS:
+      ping = true;
+      break;
+    case I2CIP_VERIFY_NEVER:
+      ping = false;
+      break;
+    case I2CIP_VERIFY_EVERY_N: {
+      uint8_t n = (this->verifyEvery == 0) ? this->getDefaultVerifyEvery() : this->verifyEvery;
+      ping = (++this->verifyCount >= n);
+      if(ping) this->verifyCount = 0;
+      break;
+    }
+    case I2CIP_VERIFY_ON_ERROR:
+    default:
+      ping = this->verifyPending;
+      break;
+  }
+  this->verifyPending = false;
+
+  if(ping) {
+    this->verified++;
+    totalVerified++;
+    return this->pingTimeout();
+  }
+
+  this->skipped++;
+  totalSkipped++;
+  return wrote ? MUX::resetBus(this->fqa) : I2CIP_ERR_NONE;
+}
+
+i2cip_errorlevel_t Device::poll(const void* args) {
+  if(this->input == nullptr) return I2CIP_ERR_SOFT;
+  if(!this->input->due()) return I2CIP_ERR_NONE; // Nothing new; no I/O
+  return this->_get(args, false);
+}
+
+i2cip_errorlevel_t Device::get(const void* args) { return this->_get(args, true); }
+
+i2cip_errorlevel_t Device::_get(const void* args, bool failsafe) { 
   if (this->input == nullptr) { 
     return I2CIP_ERR_SOFT; // TODO: Should this be NOP/NONE? or are you clearly doing something wrong
   } 
+  uint32_t start = micros();
+  I2CIP_TRACE(I2CIP_TRACE_DEVICE_GET, this->fqa, 0);
   #ifdef I2CIP_DEBUG_SERIAL
     I2CIP_DEBUG_SERIAL.print("-> DEVICE GET @0x");
     I2CIP_DEBUG_SERIAL.print((uintptr_t)this->getInput(), HEX);
@@ -167,20 +261,16 @@ i2cip_errorlevel_t Device::get(const void* args) {
     I2CIP_DEBUG_SERIAL.print(' ');
   #endif
   if(!this->ready && !this->_begin(true)) { return I2CIP_ERR_SOFT; }
-  i2cip_errorlevel_t errlev = (args == nullptr) ? this->input->failGet() : this->input->get(args);
-  if(errlev != I2CIP_ERR_NONE) {
-    this->ready = false;
-    MUX::resetBus(this->fqa); // Attempt; might be lost
-  } else {
-    errlev = this->pingTimeout();
-  }
-  return errlev;
+  i2cip_errorlevel_t errlev = (args == nullptr && failsafe) ? this->input->failGet() : this->input->get(args); // InputInterface: null args = last args
+  return this->settle(errlev, false, start);
 }
 
 i2cip_errorlevel_t Device::set(const void* value, const void* args) { 
   if (this->output == nullptr) { 
     return I2CIP_ERR_SOFT; // TODO: Should this be NOP/NONE? or are you clearly doing something wrong
   } 
+  uint32_t start = micros();
+  I2CIP_TRACE(I2CIP_TRACE_DEVICE_SET, this->fqa, 0);
   #ifdef I2CIP_DEBUG_SERIAL
     I2CIP_DEBUG_SERIAL.print("-> DEVICE SET @0x");
     I2CIP_DEBUG_SERIAL.print((uintptr_t)this->getOutput(), HEX);
@@ -192,15 +282,21 @@ i2cip_errorlevel_t Device::set(const void* value, const void* args) {
   #endif
   if(!this->ready && !this->_begin(true)) { return I2CIP_ERR_SOFT; }
   i2cip_errorlevel_t errlev = (value == nullptr) ? this->output->reset(args) : ((args == nullptr) ? this->output->failSet(value) : this->output->set(value, args));
-  if(errlev != I2CIP_ERR_NONE) {
-    this->ready = false;
-    MUX::resetBus(this->fqa); // Attempt; might be lost
-  } else {
-    errlev = this->pingTimeout();
-  }
-  return errlev;
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    if(errlev == I2CIP_ERR_NONE && this->output->wasSuppressed()) return I2CIP_ERR_NONE; // No I/O; nothing to verify
+  #endif
+  return this->settle(errlev, true, start);
 }
 
+#ifdef I2CIP_DEVICES_USE_LATENCY
+void Device::latencyToJSON(JsonObject obj) const {
+  this->latency[I2CIP_LATENCY_GET].toJSON(obj["get"].to<JsonObject>());
+  this->latency[I2CIP_LATENCY_SET].toJSON(obj["set"].to<JsonObject>());
+  this->latency[I2CIP_LATENCY_PING].toJSON(obj["ping"].to<JsonObject>());
+  this->jitter.toJSON(obj["jitter"].to<JsonObject>());
+}
+#endif
+
 const i2cip_fqa_t& Device::getFQA(void) const { return this->fqa; }
 
 // i2cip_id_t Device::getID(void) const { return this->id; }
@@ -228,9 +324,11 @@ i2cip_errorlevel_t Device::ping(const i2cip_fqa_t& fqa, bool resetbus, bool setb
 
   // End transmission, check state
   if(I2CIP_FQA_TO_WIRE(fqa)->endTransmission(true) != 0) {
+    I2CIP_TRACE(I2CIP_TRACE_DEVICE_PING, fqa, I2CIP_ERR_HARD);
     return I2CIP_ERR_HARD;
   }
 
+  I2CIP_TRACE(I2CIP_TRACE_DEVICE_PING, fqa, I2CIP_ERR_NONE);
   #ifdef I2CIP_DEBUG_SERIAL
     I2CIP_DEBUG_SERIAL.println("Pong!");
     DEBUG_DELAY();
@@ -240,68 +338,8 @@ i2cip_errorlevel_t Device::ping(const i2cip_fqa_t& fqa, bool resetbus, bool setb
   return resetbus ? I2CIP_ERR_NONE : MUX::resetBus(fqa);
 }
 
-i2cip_errorlevel_t Device::pingTimeout(const i2cip_fqa_t& fqa, bool setbus, bool resetbus, unsigned int timeout) {
-
-  i2cip_errorlevel_t errlev = setbus ? MUX::setBus(fqa) : I2CIP_ERR_NONE;
-  I2CIP_ERR_BREAK(errlev);
-
-  // Check if it's actually lost
-
-  #ifdef I2CIP_DEBUG_SERIAL
-    DEBUG_DELAY();
-    I2CIP_DEBUG_SERIAL.print(F("-> Device 0x"));
-    I2CIP_DEBUG_SERIAL.print(I2CIP_FQA_SEG_DEVADR(fqa), HEX);
-    I2CIP_DEBUG_SERIAL.print(F(" Ping... "));
-  #endif
-  
-  I2CIP_FQA_TO_WIRE(fqa)->beginTransmission(I2CIP_FQA_SEG_DEVADR(fqa));
-  errlev = (I2CIP_FQA_TO_WIRE(fqa)->endTransmission(true) == 0 ? I2CIP_ERR_NONE : I2CIP_ERR_HARD);
-  if(errlev == I2CIP_ERR_NONE) {
-    #ifdef I2CIP_DEBUG_SERIAL
-      DEBUG_DELAY();
-      I2CIP_DEBUG_SERIAL.println(F("Pong!"));
-    #endif
-    return resetbus ? MUX::resetBus(fqa) : I2CIP_ERR_NONE;
-  }
-  #ifdef I2CIP_DEBUG_SERIAL
-    DEBUG_DELAY();
-    I2CIP_DEBUG_SERIAL.print(F("LOST; Interval -> Ping... "));
-  #endif
-
-  unsigned long start = millis();
-
-  // Count down until out of time of found
-  while (errlev != I2CIP_ERR_NONE) {
-    if (millis() - start > timeout) {
-      errlev = I2CIP_ERR_HARD;
-      break;
-    }
-    #ifndef I2CIP_DEBUG_SERIAL
-      // Delta 0.1ms
-      delayMicroseconds(100);
-    #endif
-
-    // Begin transmission
-    I2CIP_FQA_TO_WIRE(fqa)->beginTransmission(I2CIP_FQA_SEG_DEVADR(fqa));
-
-    // End transmission, check state
-    errlev = (I2CIP_FQA_TO_WIRE(fqa)->endTransmission(true) == 0 ? I2CIP_ERR_NONE : I2CIP_ERR_HARD);
-
-    if (errlev == I2CIP_ERR_NONE) {
-      // Default case/quick-break
-      break;
-    }
-
-    #ifdef I2CIP_DEBUG_SERIAL
-      DEBUG_DELAY();
-      I2CIP_DEBUG_SERIAL.print(F("Ping... "));
-    #endif
-  }
-  
-  // Double check MUX before attempting to switch
-  if(errlev == I2CIP_ERR_SOFT && !MUX::pingMUX(fqa)) {
-    errlev = I2CIP_ERR_HARD;
-  }
+static inline bool _probeSettle(i2cip_probe_t& probe, i2cip_errorlevel_t errlev) {
+  probe.pending = false;
 
   #ifdef I2CIP_DEBUG_SERIAL
     if(errlev == I2CIP_ERR_HARD) {
@@ -315,25 +353,102 @@ i2cip_errorlevel_t Device::pingTimeout(const i2cip_fqa_t& fqa, bool setbus, bool
     } else {
       DEBUG_DELAY();
       I2CIP_DEBUG_SERIAL.print(F("Pong! Timeout: "));
-      I2CIP_DEBUG_SERIAL.print(millis()-start);
+      I2CIP_DEBUG_SERIAL.print(millis()-probe.start);
       I2CIP_DEBUG_SERIAL.print(F("ms\n"));
       DEBUG_DELAY();
     }
   #endif
 
   // Switch MUX bus back
-  if (resetbus) {
+  if(probe.resetbus) {
     if(errlev == I2CIP_ERR_NONE) {
-      // Default case
-      return MUX::resetBus(fqa);
-    } else if(MUX::resetBus(fqa) == I2CIP_ERR_NONE) {
-      return errlev;
-    } else {
-      return I2CIP_ERR_HARD;
+      errlev = MUX::resetBus(probe.fqa); // Default case
+    } else if(MUX::resetBus(probe.fqa) != I2CIP_ERR_NONE) {
+      errlev = I2CIP_ERR_HARD;
     }
   }
-  
-  return errlev;
+
+  probe.errlev = errlev;
+  return true;
+}
+
+bool Device::probeStart(i2cip_probe_t& probe, const i2cip_fqa_t& fqa, bool setbus, bool resetbus, unsigned int timeout, bool reselect, uint16_t ceiling) {
+  probe.fqa = fqa;
+  probe.start = millis();
+  probe.last = micros();
+  probe.backoff = 0;
+  probe.ceiling = max(ceiling, (uint16_t)I2CIP_PROBE_BACKOFF_MIN);
+  probe.timeout = timeout;
+  probe.resetbus = resetbus;
+  probe.reselect = reselect;
+  probe.pending = true;
+  probe.errlev = I2CIP_ERR_HARD;
+
+  i2cip_errorlevel_t errlev = setbus ? MUX::setBus(fqa) : I2CIP_ERR_NONE;
+  if(errlev != I2CIP_ERR_NONE) {
+    probe.pending = false;
+    probe.errlev = errlev;
+    return true;
+  }
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> Device 0x"));
+    I2CIP_DEBUG_SERIAL.print(I2CIP_FQA_SEG_DEVADR(fqa), HEX);
+    I2CIP_DEBUG_SERIAL.print(F(" Ping... "));
+  #endif
+
+  // First attempt is immediate; most devices answer here
+  probe.reselect = false; // Bus was just set
+  bool settled = probePoll(probe);
+  probe.reselect = reselect;
+  return settled;
+}
+
+bool Device::probePoll(i2cip_probe_t& probe) {
+  if(!probe.pending) return true;
+
+  unsigned long now = micros();
+  if(now - probe.last < probe.backoff) return false; // Not yet
+
+  if(probe.reselect) {
+    i2cip_errorlevel_t errlev = MUX::setBus(probe.fqa);
+    if(errlev != I2CIP_ERR_NONE) return _probeSettle(probe, errlev);
+  }
+
+  I2CIP_FQA_TO_WIRE(probe.fqa)->beginTransmission(I2CIP_FQA_SEG_DEVADR(probe.fqa));
+  if(I2CIP_FQA_TO_WIRE(probe.fqa)->endTransmission(true) == 0) return _probeSettle(probe, I2CIP_ERR_NONE);
+
+  if(millis() - probe.start > probe.timeout) return _probeSettle(probe, I2CIP_ERR_HARD);
+
+  // Exponential backoff
+  probe.last = micros();
+  probe.backoff = (probe.backoff == 0) ? I2CIP_PROBE_BACKOFF_MIN : min((uint32_t)probe.backoff * 2, (uint32_t)probe.ceiling);
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("Ping... "));
+  #endif
+
+  return false;
+}
+
+void Device::idle(void) {
+  if(Device::idleHook != nullptr) {
+    Device::idleHook();
+  } else {
+    #ifdef ESP32
+      yield(); // Let other tasks run while the device is busy
+    #endif
+  }
+}
+
+i2cip_errorlevel_t Device::pingTimeout(const i2cip_fqa_t& fqa, bool setbus, bool resetbus, unsigned int timeout, uint16_t ceiling) {
+  i2cip_probe_t probe;
+  if(!probeStart(probe, fqa, setbus, resetbus, timeout, false, ceiling)) {
+    while(!probePoll(probe)) { Device::idle(); }
+  }
+  return probe.errlev;
 }
 
 i2cip_errorlevel_t Device::writeByte(const i2cip_fqa_t& fqa, const uint8_t& value, bool setbus, bool resetbus) {
@@ -769,10 +884,126 @@ i2cip_errorlevel_t Device::readRegister(const i2cip_fqa_t& fqa, const uint16_t&
   return (success ? I2CIP_ERR_NONE : I2CIP_ERR_SOFT);
 }
 
+// Number of list-adjacent, register-contiguous segments starting at `first` that fit in `limit` bytes (at least one)
+static uint8_t _segmentRun(const i2cip_segment_t segments[], uint8_t first, uint8_t count, bool coalesce, size_t limit, size_t& total) {
+  total = segments[first].len;
+  uint8_t n = 1;
+  if(!coalesce) return n;
+  while(first + n < count) {
+    const i2cip_segment_t& last = segments[first + n - 1];
+    const i2cip_segment_t& next = segments[first + n];
+    if((uint16_t)last.reg + last.len != next.reg || total + next.len > limit) break;
+    total += next.len;
+    n++;
+  }
+  return n;
+}
+
+i2cip_errorlevel_t Device::readRegisters(const i2cip_fqa_t& fqa, const i2cip_segment_t segments[], uint8_t count, bool coalesce, bool resetbus, bool setbus) {
+  i2cip_errorlevel_t errlev = setbus ? MUX::setBus(fqa) : I2CIP_ERR_NONE;
+  I2CIP_ERR_BREAK(errlev);
+
+  for(uint8_t i = 0; i < count; ) {
+    size_t total;
+    uint8_t n = _segmentRun(segments, i, count, coalesce, I2CIP_MAXBUFFER, total);
+
+    i2cip_errorlevel_t err;
+    if(n == 1) {
+      // Single segment: read in place (readRegister chunks oversize reads itself)
+      size_t len = segments[i].len;
+      err = readRegister(fqa, segments[i].reg, segments[i].buf, len, false, false, false);
+      if(err == I2CIP_ERR_NONE && len != segments[i].len) err = I2CIP_ERR_SOFT;
+    } else {
+      // Burst into scratch; scatter
+      uint8_t scratch[I2CIP_MAXBUFFER];
+      size_t len = total;
+      err = readRegister(fqa, segments[i].reg, scratch, len, false, false, false);
+      if(err == I2CIP_ERR_NONE && len != total) err = I2CIP_ERR_SOFT;
+      if(err == I2CIP_ERR_NONE) {
+        size_t pos = 0;
+        for(uint8_t j = i; j < i + n; j++) {
+          memcpy(segments[j].buf, scratch + pos, segments[j].len);
+          pos += segments[j].len;
+        }
+      }
+    }
+
+    if(err > errlev) errlev = err;
+    if(err == I2CIP_ERR_HARD) break;
+    i += n;
+  }
+
+  if(resetbus) {
+    i2cip_errorlevel_t err = MUX::resetBus(fqa);
+    if(err > errlev) errlev = err;
+  }
+  return errlev;
+}
+
+i2cip_errorlevel_t Device::writeRegisters(const i2cip_fqa_t& fqa, const i2cip_segment_t segments[], uint8_t count, bool coalesce, bool setbus, bool resetbus) {
+  i2cip_errorlevel_t errlev = setbus ? MUX::setBus(fqa) : I2CIP_ERR_NONE;
+  I2CIP_ERR_BREAK(errlev);
+
+  for(uint8_t i = 0; i < count && errlev != I2CIP_ERR_HARD; ) {
+    size_t total;
+    uint8_t n = _segmentRun(segments, i, count, coalesce, I2CIP_MAXBUFFER - 1, total);
+
+    // Gather: | REG | DATA... |
+    uint8_t buffer[I2CIP_MAXBUFFER];
+    if(n == 1) {
+      // Single segment may exceed the Wire buffer; split it (relies on auto-increment past the first chunk)
+      for(size_t pos = 0; pos < segments[i].len; pos += I2CIP_MAXBUFFER - 1) {
+        size_t chunk = min((size_t)(segments[i].len - pos), (size_t)(I2CIP_MAXBUFFER - 1));
+        buffer[0] = (uint8_t)(segments[i].reg + pos);
+        memcpy(buffer + 1, segments[i].buf + pos, chunk);
+        i2cip_errorlevel_t err = write(fqa, buffer, chunk + 1, false, false);
+        if(err > errlev) errlev = err;
+        if(err == I2CIP_ERR_HARD) break;
+      }
+    } else {
+      buffer[0] = segments[i].reg;
+      size_t pos = 1;
+      for(uint8_t j = i; j < i + n; j++) {
+        memcpy(buffer + pos, segments[j].buf, segments[j].len);
+        pos += segments[j].len;
+      }
+      i2cip_errorlevel_t err = write(fqa, buffer, total + 1, false, false);
+      if(err > errlev) errlev = err;
+    }
+    i += n;
+  }
+
+  if(resetbus) {
+    i2cip_errorlevel_t err = MUX::resetBus(fqa);
+    if(err > errlev) errlev = err;
+  }
+  return errlev;
+}
+
 // NON-STATIC OBJECT-MEMBER FUNCTIONS (PUBLIC EXTERNAL API)
 
-i2cip_errorlevel_t Device::ping(bool resetbus, bool setbus) { i2cip_errorlevel_t errlev = Device::ping(this->fqa, resetbus, setbus); if(errlev == I2CIP_ERR_HARD) { this->unready(); } return errlev; }
-i2cip_errorlevel_t Device::pingTimeout(bool setbus, bool resetbus) { i2cip_errorlevel_t errlev = Device::pingTimeout(this->fqa, setbus, resetbus, this->timeout); if(errlev == I2CIP_ERR_HARD) { this->unready(); } return errlev; }
+i2cip_errorlevel_t Device::ping(bool resetbus, bool setbus) {
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    uint32_t start = micros();
+  #endif
+  i2cip_errorlevel_t errlev = Device::ping(this->fqa, resetbus, setbus);
+  if(errlev == I2CIP_ERR_HARD) { this->unready(); }
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    this->latency[I2CIP_LATENCY_PING].record(micros() - start);
+  #endif
+  return errlev;
+}
+i2cip_errorlevel_t Device::pingTimeout(bool setbus, bool resetbus, uint16_t ceiling) {
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    uint32_t start = micros();
+  #endif
+  i2cip_errorlevel_t errlev = Device::pingTimeout(this->fqa, setbus, resetbus, this->timeout, ceiling);
+  if(errlev == I2CIP_ERR_HARD) { this->unready(); }
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    this->latency[I2CIP_LATENCY_PING].record(micros() - start);
+  #endif
+  return errlev;
+}
 i2cip_errorlevel_t Device::writeByte(const uint8_t& value, bool setbus, bool resetbus) const { return Device::writeByte(this->fqa, value, setbus, resetbus); }
 i2cip_errorlevel_t Device::write(const uint8_t* buffer, size_t len, bool setbus, bool resetbus) const { return Device::write(this->fqa, buffer, len, setbus, resetbus); }
 i2cip_errorlevel_t Device::writeRegister(const uint8_t& reg, const uint8_t& value, bool setbus, bool resetbus) const { return Device::writeRegister(this->fqa, reg, value, setbus, resetbus); }
@@ -787,4 +1018,6 @@ i2cip_errorlevel_t Device::readRegister(const uint16_t& reg, uint8_t* dest, size
 i2cip_errorlevel_t Device::readRegisterByte(const uint8_t& reg, uint8_t& dest, bool resetbus, bool setbus) const { return Device::readRegisterByte(this->fqa, reg, dest, resetbus, setbus); }
 i2cip_errorlevel_t Device::readRegisterByte(const uint16_t& reg, uint8_t& dest, bool resetbus, bool setbus) const { return Device::readRegisterByte(this->fqa, reg, dest, resetbus, setbus); }
 i2cip_errorlevel_t Device::readRegisterWord(const uint8_t& reg, uint16_t& dest, bool resetbus, bool setbus) const { return Device::readRegisterWord(this->fqa, reg, dest, resetbus, setbus);  }
-i2cip_errorlevel_t Device::readRegisterWord(const uint16_t& reg, uint16_t& dest, bool resetbus, bool setbus) const { return Device::readRegisterWord(this->fqa, reg, dest, resetbus, setbus); }
\ No newline at end of file
+i2cip_errorlevel_t Device::readRegisterWord(const uint16_t& reg, uint16_t& dest, bool resetbus, bool setbus) const { return Device::readRegisterWord(this->fqa, reg, dest, resetbus, setbus); }
+i2cip_errorlevel_t Device::readRegisters(const i2cip_segment_t segments[], uint8_t count, bool coalesce, bool resetbus, bool setbus) const { return Device::readRegisters(this->fqa, segments, count, coalesce, resetbus, setbus); }
+i2cip_errorlevel_t Device::writeRegisters(const i2cip_segment_t segments[], uint8_t count, bool coalesce, bool setbus, bool resetbus) const { return Device::writeRegisters(this->fqa, segments, count, coalesce, setbus, resetbus); }
\ No newline at end of file
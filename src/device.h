@@ -8,9 +8,22 @@
 
 #include "fqa.h"
 #include "mux.h"
+#include "clock.h"
+#include "interrupt.h"
+#include "arena.h"
+#include "latency.h"
+
+#ifndef __AVR__
+#define I2CIP_DEVICES_USE_POOLS true // comment out to disable per-class fixed-size Device pools (plain heap new/delete)
+#endif
+
+#include "pool.h"
 
 #define I2CIP_DEVICE_TIMEOUT 10
 
+#define I2CIP_PROBE_BACKOFF_MIN 100   // us; first retry interval of a readiness probe
+#define I2CIP_PROBE_BACKOFF_MAX 3200  // us; default retry interval ceiling
+
 /**
  * Shifts and masks a number's bits.
  * @param data  Data to shift/mask
@@ -36,6 +49,7 @@ namespace I2CIP {
     void* a;
     void* s;
     void* b;
+    Arena* arena; // Optional; backs a/s/b built with `I2CIP_ARGS_NEW` (nullptr: heap)
   } _i2cip_args_io_default;
 
   typedef struct i2cip_args_io_s i2cip_args_io_t;
@@ -43,6 +57,7 @@ namespace I2CIP {
   class Module;
   template <typename G, typename A> class InputInterface;
   template <typename S, typename B> class OutputInterface;
+  template <class C> class DeviceHandle;
 }
 
 #define I2CIP_DEVICES_PER_GROUP ((size_t)8)
@@ -126,22 +141,58 @@ namespace I2CIP {
 //   I2CIP_DEVICE_USE_FACTORY(CLASS);\
 //   I2CIP_DEVICE_USE_SFACTORY(CLASS, CLASS);
 
+/**
+ * Post-I/O verification ping policy. Chooses whether `Device::get()`/`Device::set()` re-ping the device after a successful operation.
+ * - `I2CIP_VERIFY_CLASS`: Use the class default (`getDefaultVerify()`)
+ * - `I2CIP_VERIFY_ALWAYS`: Ping after every operation
+ * - `I2CIP_VERIFY_NEVER`: Never ping; trust the transaction's own ACKs
+ * - `I2CIP_VERIFY_EVERY_N`: Ping after every Nth operation
+ * - `I2CIP_VERIFY_ON_ERROR`: Ping only after the first success following `begin()` or a failed operation
+ */
+typedef enum { I2CIP_VERIFY_CLASS = 0, I2CIP_VERIFY_ALWAYS, I2CIP_VERIFY_NEVER, I2CIP_VERIFY_EVERY_N, I2CIP_VERIFY_ON_ERROR } i2cip_verify_t;
+
+#define I2CIP_VERIFY_DEFAULT I2CIP_VERIFY_ON_ERROR  // Library default policy
+#define I2CIP_VERIFY_EVERY_DEFAULT 16               // Default N for `I2CIP_VERIFY_EVERY_N`
+
+// Per-class maximum SCL frequency (Hz); see `clock.h`. Usage: `I2CIP_DEVICE_USE_CLOCK(I2CIP_CLOCK_FAST);`
+#define I2CIP_DEVICE_USE_CLOCK(HZ) \
+  public:\
+    uint32_t getMaxClock(void) const override { return (HZ); }
+
+// Per-class verification policy default. Usage: `I2CIP_DEVICE_USE_VERIFY(I2CIP_VERIFY_EVERY_N, 8);`
+#define I2CIP_DEVICE_USE_VERIFY(POLICY, ...) \
+  public:\
+    i2cip_verify_t getDefaultVerify(void) const override { return (POLICY); }\
+    uint8_t getDefaultVerifyEvery(void) const override { return __VA_OPT__(__VA_ARGS__)VALUE_IFNOT(__VA_OPT__(1), I2CIP_VERIFY_EVERY_DEFAULT); }
+
+// Per-class broadcast opt-in, for write-only drivers (no register reads in `set`). Usage: `I2CIP_DEVICE_USE_BROADCAST();`
+#define I2CIP_DEVICE_USE_BROADCAST() \
+  public:\
+    bool isBroadcastable(void) const override { return true; }
+
 #define I2CIP_DEVICE_CLASS_BUNDLE(CLASS, ...) \
   I2CIP_DEVICE_USE_STATIC_ID();\
   I2CIP_DEVICE_USE_FACTORY(CLASS  __VA_OPT__(,) __VA_ARGS__);\
   I2CIP_DEVICE_USE_SFACTORY(CLASS  __VA_OPT__(,) __VA_ARGS__);\
-  I2CIP_DEVICE_USE_JSONHANDLER(CLASS);
+  I2CIP_DEVICE_USE_JSONHANDLER(CLASS);\
+  I2CIP_DEVICE_USE_POOL(CLASS, I2CIP_POOL_SLOTS_DEFAULT);
+
+// Rendered strings are memoized: formatting only re-runs when the cache/value version changed since the last render (see `getVersion()`)
 
 // ARGS is implied to be JSON-friendly
 #define I2CIP_INPUTS_USE_TOSTRING true // uncomment to disable input cache toString/print macros
 #define I2CIP_INPUT_USE_TOSTRING(TYPE, ARGS)\
 private:\
   char cache_buffer[I2CIP_INPUT_CACHEBUFFER_SIZE];\
+  uint16_t cache_rendered = 0;\
+  bool cache_valid = false;\
 public:\
   const char* cacheToString(void) override {\
+    if(this->cache_valid && this->cache_rendered == InputGetter::getVersion()) return this->cache_buffer;\
     memset(this->cache_buffer, 0, I2CIP_INPUT_CACHEBUFFER_SIZE);\
     TYPE value = this->getCache();\
     snprintf(this->cache_buffer, I2CIP_INPUT_CACHEBUFFER_SIZE, ARGS, value);\
+    this->cache_rendered = InputGetter::getVersion(); this->cache_valid = true;\
     return this->cache_buffer;\
   }
 
@@ -149,11 +200,15 @@ public:\
 #define I2CIP_INPUT_ADD_PRINTCACHE(TYPE, ARGS)\
 private:\
     char print_buffer[I2CIP_INPUT_PRINTBUFFER_SIZE];\
+    uint16_t print_rendered = 0;\
+    bool print_valid = false;\
 public:\
   const char* printCache(void) override {\
+    if(this->print_valid && this->print_rendered == InputGetter::getVersion()) return this->print_buffer;\
     memset(this->print_buffer, 0, I2CIP_INPUT_PRINTBUFFER_SIZE);\
     TYPE value = this->getCache();\
     snprintf(this->print_buffer, I2CIP_INPUT_PRINTBUFFER_SIZE, ARGS, value);\
+    this->print_rendered = InputGetter::getVersion(); this->print_valid = true;\
     return this->print_buffer;\
   }
 
@@ -161,11 +216,15 @@ public:\
 #define I2CIP_OUTPUT_USE_TOSTRING(TYPE, ARGS, ...)\
 private:\
   char value_buffer[I2CIP_INPUT_CACHEBUFFER_SIZE];\
+  uint16_t value_rendered = 0;\
+  bool value_valid = false;\
 public:\
   const char* valueToString(void) override {\
+    if(this->value_valid && this->value_rendered == OutputSetter::getVersion()) return this->value_buffer;\
     memset(this->value_buffer, 0, I2CIP_INPUT_CACHEBUFFER_SIZE);\
     TYPE value = this->getValue();\
     snprintf(this->value_buffer, I2CIP_INPUT_CACHEBUFFER_SIZE, ARGS, __VA_OPT__(__VA_ARGS__)VALUE_IFNOT(__VA_OPT__(1), value));\
+    this->value_rendered = OutputSetter::getVersion(); this->value_valid = true;\
     return this->value_buffer;\
   }
 
@@ -187,6 +246,9 @@ public:\
 
 #endif
 
+#define I2CIP_OUTPUTS_USE_SUPPRESS true // comment out to write every `set`, even when value and args are unchanged
+#define I2CIP_OUTPUT_REFRESH_DEFAULT 10000 // (ms) Rewrite an unchanged output at least this often; 0 to never force a rewrite
+
 #define I2CIP_INPUTS_USE_RESET true // uncomment to disable input set-value reset defaulting
 #ifdef I2CIP_INPUTS_USE_RESET
 #define I2CIP_INPUT_USE_RESET(TYPE, TYPEA, ...)\
@@ -215,6 +277,13 @@ namespace I2CIP {
     protected:
       static const char failptr_get = '\a';
       unsigned long lastrx = 0; // Set by InputInterface
+      uint16_t version = 0;     // Bumped by InputInterface whenever the cache changes (read or `setCache`)
+      uint16_t reported = 0;    // `version` last accepted in a telemetry frame
+      #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+        volatile bool dirty = true;   // Interrupt fired since last read (cleared by InputInterface)
+        bool bound = false;           // Bound to an interrupt pin
+        unsigned long safety = I2CIP_INTERRUPT_SAFETY_POLL; // (ms) Max time between reads while bound
+      #endif
     public:
       virtual ~InputGetter() = 0;
       // virtual i2cip_errorlevel_t get(const void* args = nullptr) { return I2CIP_ERR_HARD; } // Unimplemented; delete this device
@@ -227,6 +296,36 @@ namespace I2CIP {
       }
 
       unsigned long getLastRX(void) const { return this->lastrx; }
+      uint16_t getVersion(void) const { return this->version; }
+
+      /**
+       * @return `true` if the cache changed since it was last marked reported (see `TelemetryFrame`)
+       */
+      bool unreported(void) const { return this->version != this->reported; }
+      void markReported(uint16_t version) { this->reported = version; } // `version` as sent; a newer change stays unreported
+
+      #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+        /**
+         * Read this input on interrupt instead of every poll. See `Interrupt::bind()`.
+         * @param pin MCU GPIO wired to the device's INT line
+         * @param mode Edge (Default: `FALLING`)
+         * @param safety (ms) Read anyway if this long passes without an edge (Default: `I2CIP_INTERRUPT_SAFETY_POLL`)
+         * @return `false` if the pin cannot interrupt or no slot is free
+         */
+        bool bindInterrupt(uint8_t pin, int mode = FALLING, unsigned long safety = I2CIP_INTERRUPT_SAFETY_POLL);
+        void unbindInterrupt(void);
+        bool isBound(void) const { return this->bound; }
+
+        void I2CIP_ISR_ATTR markDirty(void) { this->dirty = true; }
+        bool isDirty(void) const { return this->dirty; }
+
+        /**
+         * @return `true` if a read is due: unbound, interrupt pending, or safety poll lapsed
+         */
+        bool due(void) const { return !this->bound || this->dirty || (millis() - this->lastrx >= this->safety); }
+      #else
+        bool due(void) const { return true; }
+      #endif
 
       #ifdef I2CIP_INPUTS_USE_TOSTRING
         virtual const char* cacheToString(void) = 0; // To be implemented by the child class (i.e. for debugging, sensors)
@@ -238,6 +337,14 @@ namespace I2CIP {
     protected:
       static const char failptr_set = '\a';
       unsigned long lasttx = 0;
+      uint16_t version = 0;     // Bumped by OutputInterface whenever the cached value or args change
+      #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+        bool synced = false;          // Cached value/args match the device (cleared by `invalidate()`)
+        bool suppressedLast = false;  // Last `set` was skipped as redundant
+        uint16_t suppressed = 0;      // Redundant writes skipped
+        unsigned long refresh = I2CIP_OUTPUT_REFRESH_DEFAULT; // (ms) Forced rewrite interval; 0: never
+        static uint32_t totalSuppressed;
+      #endif
     public:
       virtual ~OutputSetter() = 0;
       virtual i2cip_errorlevel_t set(const void* value, const void* args = nullptr) = 0; // Unimplemented; delete this device
@@ -254,6 +361,25 @@ namespace I2CIP {
         return this->set(value, &failptr_set); }
       
       unsigned long getLastTX(void) const { return this->lasttx; }
+      uint16_t getVersion(void) const { return this->version; }
+
+      /**
+       * Update the cached value and args as if `set(value, args)` had succeeded, without any I/O (e.g. after a broadcast write reached this device).
+       */
+      virtual void mirror(const void* value = nullptr, const void* args = nullptr) { }
+      void failMirror(const void* value) { this->mirror(value, &failptr_set); }
+
+      #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+        /**
+         * Forget the cached state so the next `set` is written regardless (e.g. after the device was reset or re-begun).
+         */
+        void invalidate(void) { this->synced = false; }
+        void setRefresh(unsigned long ms) { this->refresh = ms; }
+        unsigned long getRefresh(void) const { return this->refresh; }
+        bool wasSuppressed(void) const { return this->suppressedLast; }
+        uint16_t getSuppressedCount(void) const { return this->suppressed; }
+        static uint32_t getTotalSuppressed(void) { return totalSuppressed; }
+      #endif
       
       #ifdef I2CIP_OUTPUTS_USE_TOSTRING
         virtual const char* valueToString(void) = 0; // To be implemented by the child class (i.e. for debugging, sensors)
@@ -262,9 +388,69 @@ namespace I2CIP {
 
   typedef i2cip_errorlevel_t (*i2cip_device_begin_t)(const i2cip_fqa_t& fqa, bool setbus);
 
+  /**
+   * Resumable readiness probe. Started with `Device::probeStart()`, advanced with `Device::probePoll()`.
+   * While `pending`, the MUX bus is left selected (unless `reselect`), so only bus-neutral work should run between polls.
+   */
+  typedef struct {
+    i2cip_fqa_t fqa;
+    unsigned long start;  // millis() at start
+    unsigned long last;   // micros() of last attempt
+    uint16_t backoff;     // us until next attempt
+    uint16_t ceiling;     // us; backoff ceiling
+    uint16_t timeout;     // ms
+    bool resetbus;        // Reset the MUX bus when settled
+    bool reselect;        // Re-select the MUX bus before each attempt (for interleaved probes)
+    bool pending;         // Still waiting for ACK or timeout
+    i2cip_errorlevel_t errlev; // Result, once settled
+  } i2cip_probe_t;
+
+  typedef void (*i2cip_idle_hook_t)(void);
+
+  /**
+   * One register range of a scatter/gather transaction.
+   */
+  typedef struct {
+    uint8_t reg;    // First register
+    uint8_t len;    // Bytes to transfer
+    uint8_t* buf;   // Source (write) or destination (read)
+  } i2cip_segment_t;
+
   class Device {
     private:
       bool _begin(bool setbus);
+      i2cip_errorlevel_t _get(const void* args, bool failsafe); // `failsafe`: null args read with defaults (`failGet`), else with the last args
+
+      // Verification Policy & Stats
+      i2cip_verify_t verify = I2CIP_VERIFY_CLASS;
+      uint8_t verifyEvery = 0;    // 0: class default
+      uint8_t verifyCount = 0;    // Operations since last verify (EVERY_N)
+      bool verifyPending = true;  // Verify next success (ON_ERROR)
+      uint16_t verified = 0;      // Verification pings sent
+      uint16_t skipped = 0;       // Verification pings skipped by policy
+
+      static uint32_t totalVerified;
+      static uint32_t totalSkipped;
+
+      #ifdef I2CIP_DEVICES_USE_LATENCY
+        LatencyHistogram latency[I2CIP_LATENCY_OPS]; // us per get/set/ping, including settle and verification
+        JitterTracker jitter;                         // Successful get interval
+      #endif
+
+      /**
+       * Post-I/O verification according to policy.
+       * @param wrote Was the operation a write? Skipped writes still release the MUX, since writes default `resetbus = false`
+       * @return Result of the verification ping, or MUX reset if skipped
+       */
+      i2cip_errorlevel_t postVerify(bool wrote);
+
+      /**
+       * Common tail of every get/set: on error unready, release the MUX and expedite the module; on success verify by policy.
+       * @param errlev Result of the I/O
+       * @param wrote Was the operation a write?
+       * @param start `micros()` when the operation began (latency histogram; successful reads also sample jitter)
+       */
+      i2cip_errorlevel_t settle(i2cip_errorlevel_t errlev, bool wrote, uint32_t start);
       // TODO: Rejig member protection
     protected:
       const i2cip_fqa_t fqa;
@@ -282,6 +468,7 @@ namespace I2CIP {
       void setOutput(OutputSetter* output);
       template <typename G, typename A> friend class InputInterface;
       template <typename S, typename B> friend class OutputInterface;
+      template <class C> friend class DeviceHandle;
 
       Device(i2cip_fqa_t fqa, i2cip_id_t id, unsigned int timeout = I2CIP_DEVICE_TIMEOUT);
       // Device(i2cip_fqa_t fqa) : Device(fqa, getStaticID()) { }
@@ -303,9 +490,44 @@ namespace I2CIP {
        * @param setbus Should the bus be set? (Default: `true`, set false if checking EEPROM write!)
        * @param resetbus Should the bus be reset? (Default: `true`, set false if checking EEPROM write!)
        * @param timeout Attempt duration (ms)
+       * @param ceiling Retry interval ceiling (us); `I2CIP_PROBE_BACKOFF_MIN` polls at a fixed interval (Default: `I2CIP_PROBE_BACKOFF_MAX`)
        * @return Hardware failure: Device unreachable, module check. Software failure: Failed to switch MUX bus
        */
-      static i2cip_errorlevel_t pingTimeout(const i2cip_fqa_t& fqa, bool setbus = true, bool resetbus = true, unsigned int timeout = I2CIP_DEVICE_TIMEOUT);
+      static i2cip_errorlevel_t pingTimeout(const i2cip_fqa_t& fqa, bool setbus = true, bool resetbus = true, unsigned int timeout = I2CIP_DEVICE_TIMEOUT, uint16_t ceiling = I2CIP_PROBE_BACKOFF_MAX);
+
+    public:
+      /**
+       * Start a non-blocking readiness probe. Makes the first attempt immediately.
+       * @param probe Probe state to initialize
+       * @param fqa FQA of the device
+       * @param setbus Should the bus be set? (Default: `true`)
+       * @param resetbus Should the bus be reset when settled? (Default: `true`)
+       * @param timeout Attempt duration (ms)
+       * @param reselect Re-select the bus before every retry, so other probes may be interleaved (Default: `false`)
+       * @param ceiling Retry interval ceiling (us) (Default: `I2CIP_PROBE_BACKOFF_MAX`)
+       * @return `true` if already settled (see `probe.errlev`), `false` if pending
+       */
+      static bool probeStart(i2cip_probe_t& probe, const i2cip_fqa_t& fqa, bool setbus = true, bool resetbus = true, unsigned int timeout = I2CIP_DEVICE_TIMEOUT, bool reselect = false, uint16_t ceiling = I2CIP_PROBE_BACKOFF_MAX);
+
+      /**
+       * Advance a pending probe. Attempts only once its backoff (100us, doubling to the probe's ceiling) has elapsed.
+       * @param probe Probe started with `probeStart()`
+       * @return `true` if settled (see `probe.errlev`), `false` if still pending
+       */
+      static bool probePoll(i2cip_probe_t& probe);
+
+      /**
+       * Install a callback run between probe attempts by blocking waits (e.g. `pingTimeout()`). Must not use the I2C bus.
+       * @param hook Callback, or `nullptr` to restore the default (yield on ESP32)
+       */
+      static void setIdleHook(i2cip_idle_hook_t hook) { Device::idleHook = hook; }
+
+      static void idle(void);
+
+    private:
+      static i2cip_idle_hook_t idleHook;
+
+    protected:
 
       /**
        * Write one byte to a device.
@@ -392,6 +614,28 @@ namespace I2CIP {
       static i2cip_errorlevel_t readRegister(const i2cip_fqa_t& fqa, const uint8_t& reg, uint8_t* dest, size_t& len, bool nullterminate = false, bool resetbus = true, bool setbus = true);
 
       static i2cip_errorlevel_t readRegister(const i2cip_fqa_t& fqa, const uint16_t& reg, uint8_t* dest, size_t& len, bool nullterminate = false, bool resetbus = true, bool setbus = true);
+
+      /**
+       * Scatter/gather register read. Segments adjacent in the list whose registers are contiguous are read as one auto-increment burst (up to `I2CIP_MAXBUFFER` bytes) and scattered back out.
+       * | { setbus? : MUX ADDR (7) | MUX CONFIG (8) | ACK? | } { per burst: DEV ADDR (7) | REG ADDR (8) | DEV ADDR (7) | READ BYTES (8*len) | } { resetbus? : | MUX ADDR (7) | MUX RESET (8) | ACK? | }
+       * @param fqa FQA of the device
+       * @param segments Register ranges, in transfer order
+       * @param count Number of segments
+       * @param coalesce Merge contiguous segments into bursts; disable for devices without register auto-increment (Default: `true`)
+       * @return First error encountered; stops on `I2CIP_ERR_HARD`
+       */
+      static i2cip_errorlevel_t readRegisters(const i2cip_fqa_t& fqa, const i2cip_segment_t segments[], uint8_t count, bool coalesce = true, bool resetbus = true, bool setbus = true);
+
+      /**
+       * Scatter/gather register write. Segments adjacent in the list whose registers are contiguous are gathered into one auto-increment burst (up to `I2CIP_MAXBUFFER - 1` data bytes).
+       * | { setbus? : MUX ADDR (7) | MUX CONFIG (8) | ACK? | } { per burst: DEV ADDR (7) | REG ADDR (8) | DATA BYTES (8*len) | ACK? | } { resetbus? : | MUX ADDR (7) | MUX RESET (8) | ACK? | }
+       * @param fqa FQA of the device
+       * @param segments Register ranges, in transfer order
+       * @param count Number of segments
+       * @param coalesce Merge contiguous segments into bursts; disable for devices without register auto-increment (Default: `true`)
+       * @return First error encountered; stops on `I2CIP_ERR_HARD`
+       */
+      static i2cip_errorlevel_t writeRegisters(const i2cip_fqa_t& fqa, const i2cip_segment_t segments[], uint8_t count, bool coalesce = true, bool setbus = true, bool resetbus = true);
       
 
       /**
@@ -442,6 +686,59 @@ namespace I2CIP {
       i2cip_errorlevel_t get(const void* args);
       i2cip_errorlevel_t set(const void* value, const void* args);
 
+      /**
+       * Typed fast path. Reads and writes through the handle call the driver's `get(G&, const A&)`/`set(const S&, const B&)` directly (no `void*`, no virtual dispatch).
+       * @note Unchecked downcast, like `static_cast`; the device must actually be a `C` (see `getID()`).
+       * @tparam C Concrete Device class
+       */
+      template <class C> DeviceHandle<C> as(void);
+
+      /**
+       * Scheduler read: `get(args)` only if the input is due (see `InputGetter::due()`); otherwise no I/O.
+       * Unlike `get(nullptr)`, null args re-read with the last args, without clearing the cache to its failsafe default first.
+       * @return `I2CIP_ERR_SOFT` if there is no input; `I2CIP_ERR_NONE` if not due
+       */
+      i2cip_errorlevel_t poll(const void* args = nullptr);
+
+      /**
+       * Override this device's verification policy.
+       * @param policy Policy (`I2CIP_VERIFY_CLASS` restores the class default)
+       * @param every N for `I2CIP_VERIFY_EVERY_N` (Default: `0`, class default)
+       */
+      void setVerify(i2cip_verify_t policy, uint8_t every = 0) { this->verify = policy; this->verifyEvery = every; this->verifyCount = 0; }
+      i2cip_verify_t getVerify(void) const { return this->verify == I2CIP_VERIFY_CLASS ? this->getDefaultVerify() : this->verify; }
+      virtual i2cip_verify_t getDefaultVerify(void) const { return I2CIP_VERIFY_DEFAULT; }
+      virtual uint8_t getDefaultVerifyEvery(void) const { return I2CIP_VERIFY_EVERY_DEFAULT; }
+
+      /**
+       * Can this device's `set` be broadcast to several channels at once (see `DeviceGroup::broadcast()`)?
+       * Only if the driver's `set` never reads from the device; replies from several channels would merge.
+       * @return `false` (Default; opt in with `I2CIP_DEVICE_USE_BROADCAST()`)
+       */
+      virtual bool isBroadcastable(void) const { return false; }
+
+      /**
+       * Fastest SCL frequency this device supports; votes toward its wire's clock while attached to a DeviceGroup.
+       * @return Hz (Default: `I2CIP_CLOCK_DEFAULT`; override with `I2CIP_DEVICE_USE_CLOCK(HZ)`)
+       */
+      virtual uint32_t getMaxClock(void) const { return I2CIP_CLOCK_DEFAULT; }
+
+      uint16_t getVerifiedCount(void) const { return this->verified; }
+      uint16_t getSkippedCount(void) const { return this->skipped; }
+      static uint32_t getTotalVerified(void) { return totalVerified; }
+      static uint32_t getTotalSkipped(void) { return totalSkipped; }
+
+      #ifdef I2CIP_DEVICES_USE_LATENCY
+        const LatencyHistogram& getLatency(i2cip_latency_op_t op) const { return this->latency[op < I2CIP_LATENCY_OPS ? op : I2CIP_LATENCY_GET]; }
+        const JitterTracker& getJitter(void) const { return this->jitter; }
+        void resetLatency(void) { for(uint8_t i = 0; i < I2CIP_LATENCY_OPS; i++) { this->latency[i].reset(); } this->jitter.reset(); }
+
+        /**
+         * Report latency and jitter as `{ "get": {...}, "set": {...}, "ping": {...}, "jitter": {...} }` (see LatencyHistogram, JitterTracker).
+         */
+        void latencyToJSON(JsonObject obj) const;
+      #endif
+
       const i2cip_fqa_t& getFQA(void) const;
       const i2cip_id_t& getID(void) const;
       // i2cip_id_t getID(void) const;
@@ -463,11 +760,12 @@ namespace I2CIP {
       #endif
     public:
       void unready(void) { this->ready = false; }
+      bool isReady(void) const { return this->ready; }
       
       virtual const char* getStaticID() = 0; // Pretty much just a formality to make sure you implement the macro, which has the WAY MORE useful static function variant getID()
 
       i2cip_errorlevel_t ping(bool resetbus = true, bool setbus = true);
-      i2cip_errorlevel_t pingTimeout(bool setbus = true, bool resetbus = true);
+      i2cip_errorlevel_t pingTimeout(bool setbus = true, bool resetbus = true, uint16_t ceiling = I2CIP_PROBE_BACKOFF_MAX);
       i2cip_errorlevel_t writeByte(const uint8_t& value, bool setbus = true, bool resetbus = false) const;
       i2cip_errorlevel_t write(const uint8_t* buffer, size_t len = 1, bool setbus = true, bool resetbus = false) const;
       i2cip_errorlevel_t writeRegister(const uint8_t& reg, const uint8_t& value, bool setbus = true, bool resetbus = false) const;
@@ -483,6 +781,8 @@ namespace I2CIP {
       i2cip_errorlevel_t readRegisterByte(const uint16_t& reg, uint8_t& dest, bool resetbus = true, bool setbus = true) const;
       i2cip_errorlevel_t readRegisterWord(const uint8_t& reg, uint16_t& dest, bool resetbus = true, bool setbus = true) const;
       i2cip_errorlevel_t readRegisterWord(const uint16_t& reg, uint16_t& dest, bool resetbus = true, bool setbus = true) const;
+      i2cip_errorlevel_t readRegisters(const i2cip_segment_t segments[], uint8_t count, bool coalesce = true, bool resetbus = true, bool setbus = true) const;
+      i2cip_errorlevel_t writeRegisters(const i2cip_segment_t segments[], uint8_t count, bool coalesce = true, bool setbus = true, bool resetbus = true) const;
 
       inline operator i2cip_fqa_t() const { return this->fqa; }
   };
@@ -1,5 +1,7 @@
 #include "eeprom.h"
 
+#include "topology.h"
+
 #include "debug_i2cip.h"
 
 using namespace I2CIP;
@@ -69,6 +71,60 @@ i2cip_errorlevel_t EEPROM::readContents(uint8_t* dest, size_t& num_read, size_t
   return errlev;
 }
 
+i2cip_errorlevel_t EEPROM::writeByte(const uint16_t& bytenum, const uint8_t& value, bool setbus) {
+  i2cip_errorlevel_t errlev = writeRegister(bytenum, value, setbus);
+  I2CIP_ERR_BREAK(errlev);
+
+  // Await write cycle completion
+  return pingTimeout(false, false, I2CIP_EEPROM_POLL);
+}
+
+i2cip_errorlevel_t EEPROM::verifyChecksum(const uint16_t& len, const uint16_t& crc, bool setbus) {
+  if(len + I2CIP_TOPOLOGY_TRAILER > I2CIP_EEPROM_SIZE) return I2CIP_ERR_SOFT;
+
+  uint8_t trailer[I2CIP_TOPOLOGY_TRAILER] = { 0 };
+  size_t n = I2CIP_TOPOLOGY_TRAILER;
+  i2cip_errorlevel_t errlev = readRegister(len, trailer, n, false, false, setbus);
+  I2CIP_ERR_BREAK(errlev);
+
+  bool match = (n == I2CIP_TOPOLOGY_TRAILER) && trailer[0] == '\0' && trailer[1] == I2CIP_TOPOLOGY_MAGIC && trailer[2] == (uint8_t)(crc >> 8) && trailer[3] == (uint8_t)(crc & 0xFF);
+
+  // The trailer alone survives a same-length (or shorter) rewrite that didn't clear; re-checksum the contents themselves
+  uint16_t actual = 0xFFFF;
+  for(uint16_t offset = 0; match && offset < len; offset += I2CIP_EEPROM_CHECKSUM_CHUNK) {
+    uint8_t chunk[I2CIP_EEPROM_CHECKSUM_CHUNK];
+    n = min((size_t)(len - offset), (size_t)I2CIP_EEPROM_CHECKSUM_CHUNK);
+    errlev = readRegister(offset, chunk, n, false, false, false);
+    I2CIP_ERR_BREAK(errlev);
+    if(n == 0) { match = false; break; }
+    actual = crc16(chunk, n, actual);
+  }
+  match = match && (actual == crc);
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("EEPROM Checksum 0x"));
+    I2CIP_DEBUG_SERIAL.print(crc, HEX);
+    I2CIP_DEBUG_SERIAL.println(match ? F(" Match") : F(" Mismatch"));
+    DEBUG_DELAY();
+  #endif
+
+  return match ? I2CIP_ERR_NONE : I2CIP_ERR_SOFT;
+}
+
+i2cip_errorlevel_t EEPROM::writeChecksum(const uint16_t& len, const uint16_t& crc, bool setbus) {
+  if(len + I2CIP_TOPOLOGY_TRAILER > I2CIP_EEPROM_SIZE) return I2CIP_ERR_SOFT;
+
+  // Null terminator is already in place; start after it
+  const uint8_t trailer[I2CIP_TOPOLOGY_TRAILER - 1] = { I2CIP_TOPOLOGY_MAGIC, (uint8_t)(crc >> 8), (uint8_t)(crc & 0xFF) };
+  i2cip_errorlevel_t errlev = I2CIP_ERR_NONE;
+  for(uint8_t i = 0; i < I2CIP_TOPOLOGY_TRAILER - 1; i++) {
+    errlev = writeByte((uint16_t)(len + 1 + i), trailer[i], setbus && (i == 0));
+    I2CIP_ERR_BREAK(errlev);
+  }
+  return errlev;
+}
+
 i2cip_errorlevel_t EEPROM::clearContents(bool setbus, uint16_t numbytes) {
   i2cip_errorlevel_t errlev = I2CIP_ERR_NONE;
   if(setbus) {
@@ -96,7 +152,7 @@ i2cip_errorlevel_t EEPROM::clearContents(bool setbus, uint16_t numbytes) {
     #endif
 
     // Note: Timeout ping before each byte write to await completion of last write cycle
-    errlev = pingTimeout(false, false);
+    errlev = pingTimeout(false, false, I2CIP_EEPROM_POLL);
     I2CIP_ERR_BREAK(errlev);
   }
 
@@ -143,10 +199,8 @@ i2cip_errorlevel_t EEPROM::overwriteContents(uint8_t* buffer, size_t len, bool c
       DEBUG_DELAY();
     #endif
 
-    delayMicroseconds(100);
-
-    // Note: Timeout ping before each byte write to await completion of last write cycle
-    errlev = pingTimeout(false, false);
+    // Note: Timeout ping before each byte write to await completion of last write cycle; polls at a fixed interval and runs the idle hook while the page commits
+    errlev = pingTimeout(false, false, I2CIP_EEPROM_POLL);
     I2CIP_ERR_BREAK(errlev);
 
     #ifdef I2CIP_DEBUG_SERIAL
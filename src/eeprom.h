@@ -11,6 +11,8 @@
     // SPRT EEPROM address (0x50)
 #define I2CIP_EEPROM_ADDR     80
 #define I2CIP_EEPROM_TIMEOUT  100   // If we're going to crash on a module ping fail, we should wait a bit
+#define I2CIP_EEPROM_CHECKSUM_CHUNK 16 // Bytes per read while re-checksumming contents (stack)
+#define I2CIP_EEPROM_POLL     I2CIP_PROBE_BACKOFF_MIN // us; fixed write-cycle poll interval (a ~5ms write cycle would overshoot with backoff)
 
 #define I2CIP_EEPROM_ID       "24LC32"
 #define STR_IMPL_(x) #x      //stringify argument
@@ -46,6 +48,8 @@ namespace I2CIP {
     I2CIP_DEVICE_CLASS_BUNDLE(EEPROM, I2CIP_EEPROM_ID);
 
     I2CIP_INPUT_USE_RESET(char*, uint16_t);
+    I2CIP_DEVICE_USE_VERIFY(I2CIP_VERIFY_ALWAYS); // Writes need the ACK-poll to finish
+    I2CIP_DEVICE_USE_CLOCK(I2CIP_CLOCK_FAST);
     
       // friend Device* I2CIP::eepromFactory(i2cip_fqa_t fqa);
       // friend class ControlSystemsOS::Linker; // Future-Proofing ;)
@@ -75,6 +79,23 @@ namespace I2CIP {
 
       i2cip_errorlevel_t overwriteContents(uint8_t* buffer, size_t len, bool clear = true, bool setbus = true);
 
+      /**
+       * Check the checksum trailer stamped after the contents' null terminator, then the CRC of the contents themselves.
+       * | '\0' | MAGIC | CRC HI | CRC LO | at byte `len`
+       * @note Still much cheaper than a read and parse; catches rewrites that left an old trailer in place
+       * @param len Expected content length (excluding null terminator)
+       * @param crc Expected content CRC
+       * @return `I2CIP_ERR_NONE` on match; `I2CIP_ERR_SOFT` on mismatch; `I2CIP_ERR_HARD` if unreachable
+       **/
+      i2cip_errorlevel_t verifyChecksum(const uint16_t& len, const uint16_t& crc, bool setbus = true);
+
+      /**
+       * Stamp the checksum trailer after the contents' null terminator. Byte-wise, to stay clear of page boundaries.
+       * @param len Content length (excluding null terminator)
+       * @param crc Content CRC
+       **/
+      i2cip_errorlevel_t writeChecksum(const uint16_t& len, const uint16_t& crc, bool setbus = true);
+
       /**
        * Read a section from EEPROM.
        * @param dest Destination heap (pointer reassigned, not overwritten)
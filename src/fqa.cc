@@ -1,5 +1,6 @@
 #include "fqa.h"
 
+#include "clock.h"
 #include "debug_i2cip.h"
 
 // #define BEGIN_WIRE_EVERY_TIME 1 // Uncomment to begin wire every time
@@ -27,6 +28,7 @@ bool I2CIP::beginWire(uint8_t wire) {
   bool r = wires[wire]->begin();
 
   wiresBegun[wire] = r;
+  if(r) Clock::apply(wire); // Negotiated clock (e.g. devices restored before the wire began)
   #ifdef I2CIP_DEBUG_SERIAL
     if(r) {
       DEBUG_DELAY();
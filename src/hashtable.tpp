@@ -70,6 +70,7 @@ template <typename T> T* HashTable<T>::operator[](const char* key) {
 // Public methods
 
 template <typename T> HashTableEntry<T>* HashTable<T>::set(const char* key, T* value, bool overwrite) {
+  I2CIP_TRACE(I2CIP_TRACE_HASHTABLE_SET, 0, _hash_function(key));
   #ifdef I2CIP_DEBUG_SERIAL
     DEBUG_DELAY();
     I2CIP_DEBUG_SERIAL.print(F("HashTable Set "));
@@ -124,6 +125,7 @@ template <typename T> HashTableEntry<T>* HashTable<T>::get(const char* key) {
 }
 
 template <typename T> bool HashTable<T>::remove(const char* key) {
+  I2CIP_TRACE(I2CIP_TRACE_HASHTABLE_REMOVE, 0, _hash_function(key));
   #ifdef I2CIP_DEBUG_SERIAL
     DEBUG_DELAY();
     I2CIP_DEBUG_SERIAL.print(F("HashTable Remove "));
@@ -1,6 +1,8 @@
 #ifndef I2CIP_INTERFACE_H_
 #define I2CIP_INTERFACE_H_
 
+#include <type_traits>
+
 #include <Arduino.h>
 
 #include "device.h"
@@ -57,6 +59,24 @@ namespace I2CIP {
        * Gets the input device's state.
        **/
       virtual i2cip_errorlevel_t get(G& dest, const A& args) { return I2CIP_ERR_HARD; } // Unimplemented; Disable this device
+
+      /**
+       * Devirtualized `get`: calls `C::get(G&, const A&)` directly and updates the cache as `get(const void*)` would.
+       * @tparam C Concrete class (derived from this interface)
+       */
+      template <class C> i2cip_errorlevel_t getTyped(const A& args);
+  };
+
+  /**
+   * Value equality trait; decides whether a `set` repeats the cached output (and can be skipped), and whether a `get` changed the cached input.
+   * Arithmetic and enum types compare with `==`. Anything else (notably pointers, whose pointee may change behind the same address) is never considered equal.
+   * Specialize for your own G/S/B types, e.g. `template <> struct i2cip_equal<rgb_t> { static bool equal(const rgb_t& a, const rgb_t& b) { ... } };`
+   */
+  template <typename T, typename = void> struct i2cip_equal {
+    static bool equal(const T& a, const T& b) { return false; }
+  };
+  template <typename T> struct i2cip_equal<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type> {
+    static bool equal(const T& a, const T& b) { return a == b; }
   };
 
   /**
@@ -70,6 +90,28 @@ namespace I2CIP {
       B argsB;  // Last passed arguments
 
       bool argsBset = false;
+
+      /**
+       * Resolve `set` pointers (null: repeat last; failptr: failsafe/default) into concrete value and args.
+       */
+      void resolve(const void* value, const void* args, S& val, B& arg);
+
+      #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+        /**
+         * @return `true` (and count it) if `val`/`arg` repeat the synced state within the refresh interval
+         */
+        bool redundant(const S& val, const B& arg);
+      #endif
+
+      /**
+       * Record the outcome of a driver `set`.
+       */
+      void settle(const S& val, const B& arg, i2cip_errorlevel_t errlev);
+
+      /**
+       * Replace the cached value and args; bumps the version if either changed.
+       */
+      void store(const S& val, const B& arg);
       
     protected:
       void setValue(S value);
@@ -90,6 +132,8 @@ namespace I2CIP {
 
       i2cip_errorlevel_t set(const void* value = nullptr, const void* args = nullptr) override;
 
+      void mirror(const void* value = nullptr, const void* args = nullptr) override;
+
       /**
        * Gets the arguments used for the last "set" operation.
       */
@@ -111,6 +155,12 @@ namespace I2CIP {
        * Sets the output device's state.
        **/
       virtual i2cip_errorlevel_t set(const S& value, const B& args) { return I2CIP_ERR_HARD; } // Unimplemented; Disable this device
+
+      /**
+       * Devirtualized `set`: calls `C::set(const S&, const B&)` directly, with the same suppression and caching as `set(const void*, const void*)`.
+       * @tparam C Concrete class (derived from this interface)
+       */
+      template <class C> i2cip_errorlevel_t setTyped(const S& value, const B& args);
   };
 
   /**
@@ -126,6 +176,38 @@ namespace I2CIP {
       virtual ~IOInterface() = 0;
   };
 
+  /**
+   * Statically-typed view of a Device, returned by `Device::as<C>()`.
+   * Same bookkeeping as `Device::get`/`Device::set` (begin, verify, error handling), but the driver call is resolved at compile time.
+   * The `void*` API remains for JSON-driven dispatch.
+   * @tparam C Concrete Device class
+   */
+  template <class C> class DeviceHandle {
+    static_assert(std::is_base_of<Device, C>::value, "DeviceHandle requires a Device class");
+    private:
+      C& device;
+    public:
+      explicit DeviceHandle(C& device) : device(device) { }
+
+      C& operator*(void) const { return this->device; }
+      C* operator->(void) const { return &this->device; }
+
+      /**
+       * Read into the device's cache.
+       * @param args Get arguments
+       */
+      template <class D = C> i2cip_errorlevel_t read(const typename D::i2cip_input_args_t& args);
+
+      /**
+       * Write the device's output.
+       * @param value Value to set
+       * @param args Set arguments
+       */
+      template <class D = C> i2cip_errorlevel_t write(const typename D::i2cip_output_type_t& value, const typename D::i2cip_output_args_t& args);
+
+      template <class D = C> const typename D::i2cip_input_type_t& value(void) const { return this->device.getCache(); }
+  };
+
 }
 
 #include "interface.tpp"
@@ -15,6 +15,7 @@ using I2CIP::OutputSetter;
 using I2CIP::InputInterface;
 using I2CIP::OutputInterface;
 using I2CIP::IOInterface;
+using I2CIP::DeviceHandle;
 
 template <typename G, typename A> InputInterface<G, A>::InputInterface(Device* device) { if(device != nullptr) device->setInput(this); }
 
@@ -22,7 +23,7 @@ template <typename G, typename A> InputInterface<G, A>::~InputInterface() { }
 
 template <typename G, typename A> const G& InputInterface<G, A>::getCache(void) const { return this->cache; }
 
-template <typename G, typename A> void InputInterface<G, A>::setCache(G value) { this->cache = value; }
+template <typename G, typename A> void InputInterface<G, A>::setCache(G value) { if(!i2cip_equal<G>::equal(value, this->cache)) { this->version++; } this->cache = value; }
 
 template <typename G, typename A> void InputInterface<G, A>::clearCache(void) {
   // #ifdef I2CIP_DEBUG_SERIAL
@@ -51,14 +52,25 @@ template <typename G, typename A> i2cip_errorlevel_t InputInterface<G, A>::get(c
     DEBUG_DELAY();
   #endif
 
+  // Changes are judged against the value held before this call, not the failsafe default
+  G prev = this->cache;
+  uint16_t version = this->version;
   if (args == &InputGetter::failptr_get) this->clearCache();
   G temp = this->cache;
 
   if(!this->argsAset) { this->argsA = this->getDefaultA(); this->argsAset = true; }
   A arg = (args == &InputGetter::failptr_get) ? this->getDefaultA() : ((args == nullptr) ? this->getArgsA() : *(A* const)args);
 
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+    this->dirty = false; // Clear before reading, so an edge during the read is not lost
+  #endif
+
   i2cip_errorlevel_t errlev = this->get(temp, arg);
 
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+    if(errlev != I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) this->dirty = true; // Retry next poll
+  #endif
+
   // If successful, update last cache
   if(errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) { 
     this->clearCache(); this->cache = temp; this->argsA = arg; this->lastrx = millis();
@@ -69,6 +81,30 @@ template <typename G, typename A> i2cip_errorlevel_t InputInterface<G, A>::get(c
     //   DEBUG_DELAY();
     // #endif
   }
+  // Bumped at most once, and only if the cache now differs from before the call (passing through the cleared value is not a change)
+  bool touched = (errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) || (args == &InputGetter::failptr_get);
+  this->version = version + ((touched && !i2cip_equal<G>::equal(this->cache, prev)) ? 1 : 0);
+  return errlev;
+}
+
+template <typename G, typename A> template <class C> i2cip_errorlevel_t InputInterface<G, A>::getTyped(const A& arg) {
+  static_assert(std::is_base_of<InputInterface<G, A>, C>::value, "getTyped requires a class derived from this InputInterface");
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+    this->dirty = false;
+  #endif
+
+  G prev = this->cache;
+  uint16_t version = this->version;
+  G temp = this->cache;
+  i2cip_errorlevel_t errlev = static_cast<C*>(this)->C::get(temp, arg); // Qualified: no virtual dispatch
+
+  if(errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) {
+    static_cast<C*>(this)->C::clearCache(); this->cache = temp; this->argsA = arg; this->argsAset = true; this->lastrx = millis();
+    this->version = version + (i2cip_equal<G>::equal(temp, prev) ? 0 : 1);
+  }
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+    else { this->dirty = true; }
+  #endif
   return errlev;
 }
 
@@ -76,7 +112,7 @@ template <typename S, typename B> OutputInterface<S, B>::OutputInterface(Device*
 
 template <typename S, typename B> OutputInterface<S, B>::~OutputInterface() { }
 
-template <typename S, typename B> void OutputInterface<S, B>::setValue(S value) { this->value = value; }
+template <typename S, typename B> void OutputInterface<S, B>::setValue(S value) { if(!i2cip_equal<S>::equal(value, this->value)) { this->version++; } this->value = value; }
 
 // template <typename S, typename B> void OutputInterface<S, B>::resetFailsafe(void) {
   // #ifdef I2CIP_DEBUG_SERIAL
@@ -88,7 +124,7 @@ template <typename S, typename B> void OutputInterface<S, B>::setValue(S value)
 
 template <typename S, typename B> S OutputInterface<S, B>::getValue(void) const { return this->value; }
 
-template <typename S, typename B> void OutputInterface<S, B>::setArgsB(B args) { this->argsB = args; }
+template <typename S, typename B> void OutputInterface<S, B>::setArgsB(B args) { if(!i2cip_equal<B>::equal(args, this->argsB)) { this->version++; } this->argsB = args; }
 
 template <typename S, typename B> B OutputInterface<S, B>::getArgsB(void) const { return this->argsB; }
 
@@ -115,23 +151,98 @@ template <typename S, typename B> i2cip_errorlevel_t OutputInterface<S, B>::set(
     DEBUG_DELAY();
   #endif
 
+  S val; B arg;
+  this->resolve(value, args, val, arg);
+
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    // 3A. Skip redundant writes (never a failsafe reset, and not past the refresh interval)
+    this->suppressedLast = false;
+    if(value != nullptr && value != &OutputSetter::failptr_set && this->redundant(val, arg)) return I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE;
+  #endif
+
+  // 3. Attempt `set`
+  i2cip_errorlevel_t errlev = this->set(val, arg);
+
+  // 4. If successful, update cached `value` and `args`
+  this->settle(val, arg, errlev);
+
+  return errlev;
+}
+
+template <typename S, typename B> template <class C> i2cip_errorlevel_t OutputInterface<S, B>::setTyped(const S& val, const B& arg) {
+  static_assert(std::is_base_of<OutputInterface<S, B>, C>::value, "setTyped requires a class derived from this OutputInterface");
+  if(!this->argsBset) { this->argsB = this->getDefaultB(); this->argsBset = true; }
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    this->suppressedLast = false;
+    if(this->redundant(val, arg)) return I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE;
+  #endif
+  i2cip_errorlevel_t errlev = static_cast<C*>(this)->C::set(val, arg); // Qualified: no virtual dispatch
+  this->settle(val, arg, errlev);
+  return errlev;
+}
+
+#ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+template <typename S, typename B> bool OutputInterface<S, B>::redundant(const S& val, const B& arg) {
+  if(!this->synced || !i2cip_equal<S>::equal(val, this->value) || !i2cip_equal<B>::equal(arg, this->argsB)) return false;
+  if(this->refresh != 0 && (millis() - this->lasttx) >= this->refresh) return false; // Due for a forced rewrite
+  this->suppressed++;
+  OutputSetter::totalSuppressed++;
+  this->suppressedLast = true;
+  return true;
+}
+#endif
+
+template <typename S, typename B> void OutputInterface<S, B>::settle(const S& val, const B& arg, i2cip_errorlevel_t errlev) {
+  if(errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) { this->store(val, arg); this->lasttx = millis(); };
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    this->synced = (errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE);
+  #endif
+}
+
+template <typename S, typename B> void OutputInterface<S, B>::store(const S& val, const B& arg) {
+  if(!i2cip_equal<S>::equal(val, this->value) || !i2cip_equal<B>::equal(arg, this->argsB)) this->version++;
+  this->value = val; this->argsB = arg;
+}
+
+template <typename S, typename B> void OutputInterface<S, B>::resolve(const void* value, const void* args, S& val, B& arg) {
   // If fail, reset to failsafe value
   if (value == &OutputSetter::failptr_set) this->resetFailsafe();
   // 1. If `set` value is not given, repeat last action
-  S val = ((value == nullptr || value == &OutputSetter::failptr_set) ? this->getValue() : *(S* const)value);
+  val = ((value == nullptr || value == &OutputSetter::failptr_set) ? this->getValue() : *(S* const)value);
 
   if(!this->argsBset) { this->argsB = this->getDefaultB(); this->argsBset = true; }
 
   // 2. If `set` args are not given, use last args 
-  B arg = (args == &OutputSetter::failptr_set) ? this->getDefaultB() : ((args == nullptr) ? this->getArgsB() : *(B* const)args);
+  arg = (args == &OutputSetter::failptr_set) ? this->getDefaultB() : ((args == nullptr) ? this->getArgsB() : *(B* const)args);
+}
 
-  // 3. Attempt `set`
-  i2cip_errorlevel_t errlev = this->set(val, arg);
+template <typename S, typename B> void OutputInterface<S, B>::mirror(const void* value, const void* args) {
+  S val; B arg;
+  this->resolve(value, args, val, arg);
+  this->store(val, arg); this->lasttx = millis();
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    this->synced = true;
+  #endif
+}
 
-  // 4. If successful, update cached `value` and `args`
-  if(errlev == I2CIP::i2cip_errorlevel_t::I2CIP_ERR_NONE) { this->value = val; this->argsB = arg; this->lasttx = millis(); };
+template <class C> DeviceHandle<C> Device::as(void) { return DeviceHandle<C>(static_cast<C&>(*this)); }
 
-  return errlev;
+template <class C> template <class D> i2cip_errorlevel_t DeviceHandle<C>::read(const typename D::i2cip_input_args_t& args) {
+  Device& d = this->device;
+  uint32_t start = micros();
+  if(!d.ready && !d._begin(true)) { return I2CIP_ERR_SOFT; }
+  return d.settle(this->device.template getTyped<D>(args), false, start);
+}
+
+template <class C> template <class D> i2cip_errorlevel_t DeviceHandle<C>::write(const typename D::i2cip_output_type_t& value, const typename D::i2cip_output_args_t& args) {
+  Device& d = this->device;
+  uint32_t start = micros();
+  if(!d.ready && !d._begin(true)) { return I2CIP_ERR_SOFT; }
+  i2cip_errorlevel_t errlev = this->device.template setTyped<D>(value, args);
+  #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+    if(errlev == I2CIP_ERR_NONE && this->device.wasSuppressed()) return I2CIP_ERR_NONE; // No I/O; nothing to verify
+  #endif
+  return d.settle(errlev, true, start);
 }
 
 template <typename G, typename A, typename S, typename B> IOInterface<G, A, S, B>::IOInterface(Device* device) : InputInterface<G, A>(device), OutputInterface<S, B>(device) { }
@@ -0,0 +1,111 @@
+#include "interrupt.h"
+
+#include "device.h"
+#include "debug_i2cip.h"
+
+#ifdef I2CIP_INPUTS_USE_INTERRUPTS
+
+#ifndef NOT_AN_INTERRUPT
+#define NOT_AN_INTERRUPT -1
+#endif
+
+using namespace I2CIP;
+
+typedef struct {
+  int16_t pin;          // -1: free
+  int mode;             // attachInterrupt mode
+  InputGetter* input;
+  bool attached;        // This slot owns the pin's attachInterrupt
+} i2cip_interrupt_slot_t;
+
+static i2cip_interrupt_slot_t _slots[I2CIP_INTERRUPT_SLOTS];
+static void (*_isr[I2CIP_INTERRUPT_SLOTS])(void);
+static bool _slotsInit = false;
+
+static void I2CIP_ISR_ATTR _fire(uint8_t s) {
+  int16_t pin = _slots[s].pin;
+  for(uint8_t i = 0; i < I2CIP_INTERRUPT_SLOTS; i++) {
+    if(_slots[i].pin == pin && _slots[i].input != nullptr) _slots[i].input->markDirty();
+  }
+}
+
+// One trampoline per slot, since attachInterrupt takes no context
+template <uint8_t S> static void I2CIP_ISR_ATTR _trampoline(void) { _fire(S); }
+template <uint8_t S> struct _trampolines { static void fill(void (**table)(void)) { table[S - 1] = &_trampoline<S - 1>; _trampolines<S - 1>::fill(table); } };
+template <> struct _trampolines<0> { static void fill(void (**table)(void)) { } };
+
+static void _init(void) {
+  if(_slotsInit) return;
+  for(uint8_t i = 0; i < I2CIP_INTERRUPT_SLOTS; i++) { _slots[i] = { -1, 0, nullptr, false }; }
+  _trampolines<I2CIP_INTERRUPT_SLOTS>::fill(_isr);
+  _slotsInit = true;
+}
+
+bool Interrupt::bind(uint8_t pin, InputGetter* input, int mode) {
+  if(input == nullptr || digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT) return false;
+  _init();
+  unbind(input);
+
+  bool shared = false;
+  int8_t slot = -1;
+  for(uint8_t i = 0; i < I2CIP_INTERRUPT_SLOTS; i++) {
+    if(_slots[i].pin == pin && _slots[i].attached) shared = true;
+    if(slot < 0 && _slots[i].pin < 0) slot = i;
+  }
+  if(slot < 0) return false;
+
+  noInterrupts();
+  _slots[slot] = { (int16_t)pin, mode, input, !shared };
+  interrupts();
+  input->markDirty(); // Read once before trusting the line
+
+  if(!shared) {
+    pinMode(pin, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(pin), _isr[slot], mode);
+  }
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> Interrupt Bind Pin "));
+    I2CIP_DEBUG_SERIAL.print(pin);
+    I2CIP_DEBUG_SERIAL.print(F(" Slot "));
+    I2CIP_DEBUG_SERIAL.print(slot);
+    I2CIP_DEBUG_SERIAL.print(shared ? F(" (Shared)\n") : F("\n"));
+    DEBUG_DELAY();
+  #endif
+  return true;
+}
+
+void Interrupt::unbind(InputGetter* input) {
+  if(input == nullptr) return;
+  _init();
+  for(uint8_t i = 0; i < I2CIP_INTERRUPT_SLOTS; i++) {
+    if(_slots[i].input != input) continue;
+    int16_t pin = _slots[i].pin;
+    bool owner = _slots[i].attached;
+
+    noInterrupts();
+    _slots[i] = { -1, 0, nullptr, false };
+    interrupts();
+
+    if(!owner) continue;
+
+    // Hand the attachment to another slot on the same pin, or detach
+    detachInterrupt(digitalPinToInterrupt((uint8_t)pin));
+    for(uint8_t j = 0; j < I2CIP_INTERRUPT_SLOTS; j++) {
+      if(_slots[j].pin != pin) continue;
+      _slots[j].attached = true;
+      attachInterrupt(digitalPinToInterrupt((uint8_t)pin), _isr[j], _slots[j].mode);
+      break;
+    }
+  }
+}
+
+uint8_t Interrupt::count(void) {
+  _init();
+  uint8_t n = 0;
+  for(uint8_t i = 0; i < I2CIP_INTERRUPT_SLOTS; i++) { if(_slots[i].pin >= 0) n++; }
+  return n;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef I2CIP_INTERRUPT_H_
+#define I2CIP_INTERRUPT_H_
+
+#include <Arduino.h>
+
+// ---------------------------------------
+// INTERRUPT: Event-Driven Inputs
+// ---------------------------------------
+// An input bound to an MCU GPIO (e.g. MCP23017 INTA, Seesaw INT) is only read when its line has fired since the last read,
+// or when its safety-poll interval has lapsed (in case an edge was missed). Unbound inputs are always due, as before.
+// `attachInterrupt` only takes plain function pointers, so each slot gets its own trampoline. Devices sharing an (open-drain, wired-OR) line
+// share one attachment; an edge marks every input bound to that pin dirty.
+
+#define I2CIP_INPUTS_USE_INTERRUPTS true // comment out to disable interrupt binding (all inputs polled)
+#define I2CIP_INTERRUPT_SLOTS       8     // Max bound inputs
+#define I2CIP_INTERRUPT_SAFETY_POLL 1000  // ms; read a bound input at least this often (Default)
+
+#if defined(ESP32) || defined(ESP8266)
+#define I2CIP_ISR_ATTR IRAM_ATTR
+#else
+#define I2CIP_ISR_ATTR
+#endif
+
+namespace I2CIP {
+  class InputGetter;
+
+  #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+  namespace Interrupt {
+    /**
+     * Bind an input to an interrupt pin. Re-binding an input moves it to the new pin.
+     * @param pin MCU GPIO (must support `digitalPinToInterrupt`)
+     * @param input Input to mark dirty on each edge
+     * @param mode `FALLING` (Default; open-drain INT lines), `RISING`, or `CHANGE`
+     * @return `false` if the pin has no interrupt or all slots are taken
+     */
+    bool bind(uint8_t pin, InputGetter* input, int mode = FALLING);
+
+    /**
+     * Unbind an input; detaches the pin when its last input is unbound.
+     */
+    void unbind(InputGetter* input);
+
+    /**
+     * @return Number of bound inputs
+     */
+    uint8_t count(void);
+  };
+  #endif
+};
+
+#endif
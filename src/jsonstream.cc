@@ -0,0 +1,101 @@
+#include "jsonstream.h"
+
+using namespace I2CIP;
+
+void JsonStream::separate(void) {
+  if(this->keyed) { this->keyed = false; return; }
+  if(this->depth == 0) return;
+  uint16_t bit = (uint16_t)1 << (this->depth - 1);
+  if(this->commas & bit) this->out.print(',');
+  else this->commas |= bit;
+}
+
+void JsonStream::open(char c) {
+  this->separate();
+  this->out.print(c);
+  if(this->depth < I2CIP_JSONSTREAM_DEPTH) {
+    uint16_t bit = (uint16_t)1 << this->depth;
+    this->commas &= ~bit;
+    if(c == '[') this->arrays |= bit;
+    else this->arrays &= ~bit;
+    this->depth++;
+  }
+}
+
+void JsonStream::close(char c) {
+  if(this->depth > 0) this->depth--;
+  this->keyed = false;
+  this->out.print(c);
+}
+
+void JsonStream::string(const char* s) {
+  this->out.print('"');
+  if(s != nullptr) {
+    for(; *s != '\0'; s++) {
+      char c = *s;
+      switch(c) {
+        case '"': this->out.print(F("\\\"")); break;
+        case '\\': this->out.print(F("\\\\")); break;
+        case '\n': this->out.print(F("\\n")); break;
+        case '\r': this->out.print(F("\\r")); break;
+        case '\t': this->out.print(F("\\t")); break;
+        default:
+          if((uint8_t)c < 0x20) {
+            // Other control characters as \u00XX
+            this->out.print(F("\\u00"));
+            if((uint8_t)c < 0x10) this->out.print('0');
+            this->out.print((uint8_t)c, HEX);
+          } else {
+            this->out.print(c);
+          }
+          break;
+      }
+    }
+  }
+  this->out.print('"');
+}
+
+JsonStream& JsonStream::key(const char* k) {
+  this->separate();
+  this->string(k);
+  this->out.print(':');
+  this->keyed = true;
+  return *this;
+}
+
+void JsonStream::value(const char* v) {
+  this->separate();
+  if(v == nullptr) { this->out.print(F("null")); return; }
+  this->string(v);
+}
+
+void JsonStream::value(bool v) {
+  this->separate();
+  this->out.print(v ? F("true") : F("false"));
+}
+
+void JsonStream::value(long v) {
+  this->separate();
+  this->out.print(v);
+}
+
+void JsonStream::value(unsigned long v) {
+  this->separate();
+  this->out.print(v);
+}
+
+void JsonStream::null(void) {
+  this->separate();
+  this->out.print(F("null"));
+}
+
+void JsonStream::end(void) {
+  while(this->depth > 0) {
+    // Close whatever was left open; the caller should not rely on this
+    this->depth--;
+    this->out.print((this->arrays & ((uint16_t)1 << this->depth)) ? ']' : '}');
+  }
+  this->out.println();
+  this->commas = 0;
+  this->keyed = false;
+}
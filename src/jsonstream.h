@@ -0,0 +1,60 @@
+#ifndef I2CIP_JSONSTREAM_H_
+#define I2CIP_JSONSTREAM_H_
+
+#include <Arduino.h>
+
+// ---------------------------------------
+// JSONSTREAM: Constant-Memory JSON Writer
+// ---------------------------------------
+// Writes JSON token-by-token straight to a `Print&`, so documents of any size (i.e. the device tree) can be emitted without
+// first being built in RAM. The only state is two bits per nesting level (container type, and whether it needs a comma).
+// No validation is done: keys must only be written inside objects, and every `begin*()` must be matched by its `end*()`.
+
+#define I2CIP_JSONSTREAM_DEPTH 16 // Max nesting depth (one bit each)
+
+namespace I2CIP {
+
+  class JsonStream {
+    private:
+      Print& out;
+      uint16_t commas = 0;  // Bit n: level n already has a member
+      uint16_t arrays = 0;  // Bit n: level n is an array (else an object)
+      uint8_t depth = 0;
+      bool keyed = false;   // A key was just written; the next value follows it without a comma
+
+      void separate(void);
+      void open(char c);
+      void close(char c);
+      void string(const char* s);
+
+    public:
+      JsonStream(Print& out) : out(out) { }
+
+      void beginObject(void) { this->open('{'); }
+      void endObject(void) { this->close('}'); }
+      void beginArray(void) { this->open('['); }
+      void endArray(void) { this->close(']'); }
+
+      JsonStream& key(const char* k);
+
+      void value(const char* v);
+      void value(bool v);
+      void value(long v);
+      void value(unsigned long v);
+      void value(int v) { this->value((long)v); }
+      void value(unsigned int v) { this->value((unsigned long)v); }
+      void null(void);
+
+      // Shorthand: `"k": v`
+      template <typename T> void member(const char* k, T v) { this->key(k).value(v); }
+
+      /**
+       * End the message (newline). Any open containers are closed first.
+       */
+      void end(void);
+
+      uint8_t getDepth(void) const { return this->depth; }
+  };
+};
+
+#endif
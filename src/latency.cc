@@ -0,0 +1,92 @@
+#include "latency.h"
+
+using namespace I2CIP;
+
+uint8_t LatencyHistogram::bucket(uint32_t us) {
+  uint8_t b = 0;
+  while(us > 1 && b < I2CIP_LATENCY_BUCKETS - 1) {
+    us >>= 1;
+    b++;
+  }
+  return b;
+}
+
+void LatencyHistogram::record(uint32_t us) {
+  uint8_t b = LatencyHistogram::bucket(us);
+  if(this->buckets[b] == UINT16_MAX) {
+    // Age out: halve every bucket
+    for(uint8_t i = 0; i < I2CIP_LATENCY_BUCKETS; i++) this->buckets[i] >>= 1;
+  }
+  this->buckets[b]++;
+  this->count++;
+  if(us < this->min) this->min = us;
+  if(us > this->max) this->max = us;
+}
+
+void LatencyHistogram::reset(void) {
+  for(uint8_t i = 0; i < I2CIP_LATENCY_BUCKETS; i++) this->buckets[i] = 0;
+  this->count = 0;
+  this->min = UINT32_MAX;
+  this->max = 0;
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t p) const {
+  uint32_t total = 0;
+  for(uint8_t i = 0; i < I2CIP_LATENCY_BUCKETS; i++) total += this->buckets[i];
+  if(total == 0) return 0;
+  if(p > 100) p = 100;
+
+  uint32_t rank = (total * p + 99) / 100; // Samples at or below the percentile (ceil)
+  if(rank == 0) rank = 1;
+  uint32_t seen = 0;
+  for(uint8_t i = 0; i < I2CIP_LATENCY_BUCKETS; i++) {
+    seen += this->buckets[i];
+    if(seen >= rank) {
+      uint32_t top = (i == I2CIP_LATENCY_BUCKETS - 1) ? this->max : (((uint32_t)1 << (i + 1)) - 1);
+      return (top > this->max) ? this->max : top;
+    }
+  }
+  return this->max;
+}
+
+void LatencyHistogram::toJSON(JsonObject obj) const {
+  obj["n"] = this->count;
+  obj["min"] = this->getMin();
+  obj["max"] = this->max;
+  obj["p50"] = this->percentile(50);
+  obj["p99"] = this->percentile(99);
+  JsonArray hist = obj["hist"].to<JsonArray>();
+  for(uint8_t i = 0; i < I2CIP_LATENCY_BUCKETS; i++) hist.add(this->buckets[i]);
+}
+
+void JitterTracker::sample(uint32_t now) {
+  if(this->samples > 0) {
+    uint32_t d = now - this->last;
+    if(this->samples > 1) {
+      uint32_t diff = (d > this->interval) ? (d - this->interval) : (this->interval - d);
+      this->jitter += diff - (this->jitter >> 4);
+    }
+    this->interval = d;
+    if(d < this->minInterval) this->minInterval = d;
+    if(d > this->maxInterval) this->maxInterval = d;
+  }
+  this->last = now;
+  this->samples++;
+}
+
+void JitterTracker::reset(void) {
+  this->last = 0;
+  this->interval = 0;
+  this->jitter = 0;
+  this->minInterval = UINT32_MAX;
+  this->maxInterval = 0;
+  this->samples = 0;
+}
+
+void JitterTracker::toJSON(JsonObject obj) const {
+  obj["n"] = this->samples;
+  obj["interval"] = this->interval;
+  obj["min"] = this->getMinInterval();
+  obj["max"] = this->maxInterval;
+  obj["jitter"] = this->getJitter();
+}
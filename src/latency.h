@@ -0,0 +1,90 @@
+#ifndef I2CIP_LATENCY_H_
+#define I2CIP_LATENCY_H_
+
+#include <Arduino.h>
+
+#include <ArduinoJson.h>
+
+// ---------------------------------------
+// LATENCY: Histograms and Jitter
+// ---------------------------------------
+// Each Device keeps one log2-bucketed histogram of operation latency (microseconds) per operation type (get, set, ping),
+// and the jitter of its successful reads' inter-sample interval (RFC 3550 estimator: J += (|D| - J) / 16).
+// Buckets are fixed: bucket 0 is [0, 2)us, bucket b is [2^b, 2^(b+1))us, and the last bucket is open-ended (>= 2^15us = 32.8ms).
+// When a bucket would overflow, every bucket is halved, so the shape stays current instead of saturating.
+// Query with `{"stats": FQA}`; jitter is also exported with each telemetry entry (`"j"`).
+
+#ifndef __AVR__
+#define I2CIP_DEVICES_USE_LATENCY true // comment out to disable per-device latency histograms and jitter tracking
+#endif
+
+#define I2CIP_LATENCY_BUCKETS 16
+
+typedef enum { I2CIP_LATENCY_GET = 0, I2CIP_LATENCY_SET, I2CIP_LATENCY_PING, I2CIP_LATENCY_OPS } i2cip_latency_op_t;
+
+namespace I2CIP {
+
+  class LatencyHistogram {
+    private:
+      uint16_t buckets[I2CIP_LATENCY_BUCKETS] = { 0 };
+      uint32_t count = 0;         // Samples recorded (not halved)
+      uint32_t min = UINT32_MAX;  // us
+      uint32_t max = 0;           // us
+
+    public:
+      /**
+       * @return Bucket index for a latency
+       */
+      static uint8_t bucket(uint32_t us);
+
+      void record(uint32_t us);
+      void reset(void);
+
+      uint32_t getCount(void) const { return this->count; }
+      uint32_t getMin(void) const { return this->count == 0 ? 0 : this->min; }
+      uint32_t getMax(void) const { return this->max; }
+      uint16_t getBucket(uint8_t b) const { return b < I2CIP_LATENCY_BUCKETS ? this->buckets[b] : 0; }
+
+      /**
+       * Upper bound on the p-th percentile: the top of the bucket it falls in (clamped to the max seen).
+       * @param p Percentile, 0-100
+       * @return us; `0` if empty
+       */
+      uint32_t percentile(uint8_t p) const;
+
+      /**
+       * Report as `{ "n", "min", "max", "p50", "p99", "hist": [...] }`.
+       */
+      void toJSON(JsonObject obj) const;
+  };
+
+  class JitterTracker {
+    private:
+      uint32_t last = 0;                  // us; previous sample
+      uint32_t interval = 0;              // us; previous interval
+      uint32_t jitter = 0;                // us * 16
+      uint32_t minInterval = UINT32_MAX;  // us
+      uint32_t maxInterval = 0;           // us
+      uint32_t samples = 0;
+
+    public:
+      /**
+       * Mark one sample (i.e. a successful read) at `now`.
+       */
+      void sample(uint32_t now);
+      void reset(void);
+
+      uint32_t getSamples(void) const { return this->samples; }
+      uint32_t getInterval(void) const { return this->interval; }
+      uint32_t getMinInterval(void) const { return this->samples < 2 ? 0 : this->minInterval; }
+      uint32_t getMaxInterval(void) const { return this->maxInterval; }
+      uint32_t getJitter(void) const { return this->jitter >> 4; }
+
+      /**
+       * Report as `{ "n", "interval", "min", "max", "jitter" }` (us).
+       */
+      void toJSON(JsonObject obj) const;
+  };
+};
+
+#endif
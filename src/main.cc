@@ -18,6 +18,16 @@ FSM::Variable cycle(FSM::Number(0, false, false), "cycle");
 FSM::Flag watering(false);
 FSM::Flag lighting(false);
 
+// Module Factory - Called by Presence::tick when a MUX answers on an empty slot
+Module* moduleFactory(const uint8_t& wire, const uint8_t& m) {
+  Module* module = new TestModule(wire, m);
+  if(m == 0) {
+    // First Module - Add HT16K33
+    module->operator()<HT16K33>(I2CIP::sevenSegmentFQA, true, _i2cip_args_io_default, NullStream);
+  }
+  return module;
+}
+
 void setup(void) {
   // 0. Builtin LED Pinmode; Serial Begin
 
@@ -33,6 +43,17 @@ void setup(void) {
   watering.addLatchingConditional(true, false, controlPin<LED_BUILTIN>); // Latching Flag Conditional - Call on toggle
   FSM::Chronos.addIntervalFlag(PERIOD_WATERING, &watering); // Timer Flag Interval - Watering ON (No-Invert)
   FSM::Chronos.addIntervalFlag(PERIOD_WATERING, DURATION_WATERING, &watering, true); // Timer Flag Interval - Watering OFF (Invert)
+
+  #if defined(I2CIP_TOPOLOGY_USE_SNAPSHOT) && defined(I2CIP_MODULES_USE_TOPOLOGY)
+    // Cold Boot - Bring last-known modules online before their EEPROMs are read; self-check verifies them in the background
+    if(I2CIP::Snapshot::load()) {
+      for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
+        if(I2CIP::modules[m] != nullptr || !I2CIP::Topology::valid(I2CIP::topologies[WIRENUM][m], WIRENUM)) continue;
+        I2CIP::modules[m] = moduleFactory(WIRENUM, m);
+        if(!I2CIP::modules[m]->restore()) { delete I2CIP::modules[m]; I2CIP::modules[m] = nullptr; }
+      }
+    }
+  #endif
 }
 
 // LOOP GLOBALS
@@ -40,6 +61,17 @@ unsigned long last = 0;
 unsigned long lastHeartbeat = 0;
 uint32_t fps = 0; // Something other than zero
 bool revision = false;
+I2CIP::TelemetryFrame telemetry;
+
+#ifdef I2CIP_OUTPUT_USE_SINK
+// Output Sink - Buffered; drained each cycle as the TX buffer has room, so a slow port never stalls the loop
+I2CIP::OutputSink sink(Serial);
+I2CIP::SinkChannel& telemetryOut = sink.telemetry(); // Frames are held back (not lost) while the ring is full
+void routeCommand(JsonObject command, Print& out) { I2CIP::commandRouter(command, sink.responses()); } // Answers are never dropped
+#else
+Print& telemetryOut = Serial;
+#define routeCommand I2CIP::commandRouter
+#endif
 
 void loop(void) {
   last = millis();
@@ -48,41 +80,39 @@ void loop(void) {
   #endif
 
   while(Serial.available() > 0) { // With baud 115200, this should not block
-    DebugJson::update(Serial, I2CIP::commandRouter);
+    DebugJson::update(Serial, routeCommand);
   }
 
   if(millis() - lastHeartbeat >= HEARTBEAT_DELAY) {
-    DebugJson::heartbeat(millis(), Serial);
-    DebugJson::revision(I2CIP_REVISION, Serial);
-    DebugJson::telemetry(millis(), fps, "fps", Serial);
+    DebugJson::heartbeat(millis(), telemetryOut);
+    DebugJson::revision(I2CIP_REVISION, telemetryOut);
+    DebugJson::telemetry(millis(), fps, "fps", telemetryOut);
     lastHeartbeat = millis();
   }
 
+  // Presence - Self-check due modules only, within budget; found/lost modules are built/deleted in-place
+  I2CIP::Presence::tick(WIRENUM, moduleFactory);
+
+  // Inputs - Read due inputs only: unbound inputs every cycle, interrupt-bound inputs on an edge (or their safety poll)
   for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
-    if(I2CIP::MUX::pingMUX(WIRENUM, m)) {
-      if(I2CIP::modules[m] == nullptr) {
-        I2CIP::modules[m] = new TestModule(WIRENUM, m);
-
-        if(m == 0) {
-          // First Module - Add HT16K33
-          I2CIP::modules[m]->operator()<HT16K33>(I2CIP::sevenSegmentFQA, true, _i2cip_args_io_default, NullStream);
-        }
-      }
+    if(I2CIP::modules[m] == nullptr) continue;
+    #ifdef I2CIP_INPUTS_USE_INTERRUPTS
+      bindInterrupts(*I2CIP::modules[m]);
+    #endif
+    I2CIP::modules[m]->poll();
+  }
 
-      I2CIP::errlev[m] = I2CIP::modules[m]->operator()();
-      // if(I2CIP::errlev[m] == I2CIP_ERR_NONE) {
-      //   if(!revision) {
-      //     DebugJson::revision(I2CIP_REVISION, Serial); // sends revision
-      //     revision = true; // Revision sent
-      //   }
-      // } else {
-      //   revision = false; // No revision sent
-      // }
-    } else {
-      I2CIP::errlev[m] = I2CIP_ERR_HARD;
-    }
+  // Telemetry - One aggregated frame per cycle of every input cache that changed since last sent
+  telemetry.begin(); // Base at now: every lastrx precedes it, so ages are never negative
+  telemetry.collect();
+  telemetry.send(telemetryOut);
 
-    #ifdef I2CIP_DEBUG_SERIAL
+  #ifdef I2CIP_OUTPUT_USE_SINK
+    sink.drain();
+  #endif
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
       // Debug Serial Output
       DEBUG_DELAY();
       I2CIP_DEBUG_SERIAL.print(F("-> Module "));
@@ -90,15 +120,8 @@ void loop(void) {
       I2CIP_DEBUG_SERIAL.print(": ");
       I2CIP_DEBUG_SERIAL.println(I2CIP::modules[m] == nullptr ? "Null" : ("0x" + String(I2CIP::errlev[m], HEX)));
       DEBUG_DELAY();
-    #endif
-  }
-
-  for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
-    if(I2CIP::modules[m] != nullptr && I2CIP::errlev[m] == I2CIP_ERR_HARD) {
-      delete I2CIP::modules[m];
-      I2CIP::modules[m] = nullptr;
     }
-  }
+  #endif
   
   cycle.set(cycle.get() + FSM::Number(1, false, false)); // Set cycle and do conditionals & callbacks(?)
 
@@ -1,6 +1,8 @@
 #include "module.h"
 
 #include "debug_i2cip.h"
+#include "snapshot.h"
+#include "clock.h"
 
 // #ifndef I2CIP_MODULE_T_FIX
 // #define I2CIP_MODULE_T_FIX
@@ -50,6 +52,7 @@ DeviceGroup::~DeviceGroup() {
     if(this->devices[i] != nullptr) {
       i2cip_fqa_t fqa = this->devices[i]->getFQA();
       I2CIP::devicetree.remove(fqa);
+      Clock::unvote(fqa, this->devices[i]->getMaxClock());
       delete(this->devices[i]);
       this->devices[i] = nullptr;
     }
@@ -113,6 +116,7 @@ bool DeviceGroup::add(Device* device) {
   // Append new devices
   this->devices[n] = device;
   this->numdevices = (n + 1);
+  Clock::vote(device->getFQA(), device->getMaxClock());
   return true;
 }
 
@@ -124,6 +128,7 @@ bool DeviceGroup::addGroup(Device* devices[], uint8_t numdevices) {
   for(unsigned int i = 0; i < numdevices && (n + i) < I2CIP_DEVICES_PER_GROUP; i++) {
     this->devices[n+i] = devices[i];
     this->numdevices++;
+    if(devices[i] != nullptr) Clock::vote(devices[i]->getFQA(), devices[i]->getMaxClock());
   }
   return true;
 }
@@ -136,6 +141,7 @@ void DeviceGroup::remove(Device* device) {
       this->devices[i - 1] = this->devices[i];
     }
     if(this->devices[i]->getFQA() == device->getFQA()) { 
+      Clock::unvote(device->getFQA(), device->getMaxClock());
       this->devices[i] = nullptr;
       this->numdevices--;
       swap = true;
@@ -159,6 +165,77 @@ Device* DeviceGroup::operator[](const i2cip_fqa_t& fqa) const {
   return nullptr;
 }
 
+i2cip_errorlevel_t DeviceGroup::broadcast(const void* value, const void* args) {
+  i2cip_errorlevel_t worst = I2CIP_ERR_NONE;
+  bool done[I2CIP_DEVICES_PER_GROUP] = { false };
+
+  for(uint8_t i = 0; i < this->numdevices; i++) {
+    if(done[i] || this->devices[i] == nullptr) continue;
+    Device* leader = this->devices[i];
+    const i2cip_fqa_t& fqa = leader->getFQA();
+    uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa), m = I2CIP_FQA_SEG_MODULE(fqa), addr = I2CIP_FQA_SEG_DEVADR(fqa);
+    done[i] = true;
+
+    // Collect same-address peers on other channels of the same (real) MUX
+    uint8_t mask = 0;
+    Device* peers[I2CIP_DEVICES_PER_GROUP] = { nullptr }; uint8_t numpeers = 0;
+    bool shared = (value != nullptr && leader->isBroadcastable() && m != I2CIP_MUX_NUM_FAKE && I2CIP_FQA_SEG_MUXBUS(fqa) != I2CIP_MUX_BUS_FAKE && leader->isReady());
+    if(shared) {
+      mask = (1 << I2CIP_FQA_SEG_MUXBUS(fqa));
+      for(uint8_t j = i + 1; j < this->numdevices; j++) {
+        Device* d = this->devices[j];
+        if(done[j] || d == nullptr || !d->isReady()) continue;
+        const i2cip_fqa_t& f = d->getFQA();
+        if(I2CIP_FQA_SEG_I2CBUS(f) != wire || I2CIP_FQA_SEG_MODULE(f) != m || I2CIP_FQA_SEG_DEVADR(f) != addr) continue;
+        uint8_t bit = (1 << I2CIP_FQA_SEG_MUXBUS(f));
+        if(I2CIP_FQA_SEG_MUXBUS(f) == I2CIP_MUX_BUS_FAKE || (mask & bit)) continue;
+        mask |= bit;
+        peers[numpeers++] = d;
+        done[j] = true;
+      }
+    }
+
+    i2cip_errorlevel_t errlev;
+    if(numpeers == 0) {
+      errlev = leader->set(value, args);
+    } else {
+      #ifdef I2CIP_DEBUG_SERIAL
+        DEBUG_DELAY();
+        I2CIP_DEBUG_SERIAL.print(F("-> Broadcast '"));
+        I2CIP_DEBUG_SERIAL.print(this->key);
+        I2CIP_DEBUG_SERIAL.print(F("' Mask 0b"));
+        I2CIP_DEBUG_SERIAL.print(mask, BIN);
+        I2CIP_DEBUG_SERIAL.print('\n');
+        DEBUG_DELAY();
+      #endif
+      #ifdef I2CIP_OUTPUTS_USE_SUPPRESS
+        leader->getOutput()->invalidate(); // The write must reach the peers even if the leader already holds this value
+      #endif
+      errlev = MUX::beginBroadcast(wire, m, mask);
+      if(errlev == I2CIP_ERR_NONE) errlev = leader->set(value, args);
+      i2cip_errorlevel_t end = MUX::endBroadcast(wire, m);
+      if(end > errlev) errlev = end;
+
+      if(errlev == I2CIP_ERR_NONE) {
+        for(uint8_t p = 0; p < numpeers; p++) {
+          OutputSetter* out = peers[p]->getOutput();
+          if(out == nullptr) continue;
+          if(args == nullptr) out->failMirror(value); else out->mirror(value, args); // Match `Device::set()`
+        }
+      } else {
+        // Can't tell which channel failed (or the session never began, and the leader was not written); fall back to individual writes
+        errlev = leader->set(value, args);
+        for(uint8_t p = 0; p < numpeers; p++) {
+          i2cip_errorlevel_t e = peers[p]->set(value, args);
+          if(e > worst) worst = e;
+        }
+      }
+    }
+    if(errlev > worst) worst = errlev;
+  }
+  return worst;
+}
+
 Device* DeviceGroup::operator()(i2cip_fqa_t fqa) {
   Device* device = this->operator[](fqa);
   if(device != nullptr) return device;
@@ -215,6 +292,8 @@ Module::Module(const i2cip_fqa_t& eeprom_fqa) : wire(I2CIP_FQA_SEG_I2CBUS(eeprom
   // NOTE: I MOVED THIS STEP TO DISCOVER, FLAGGED WITH `eeprom_added`, & MADE DEVICEGROUPFACTORY PURE VIRTUAL
   // This potentially useful if I decide to ping in deviceFactory
   // this->add(*eeprom); // Add EEPROM to module - note that this will call Module::deviceGroupFactory()
+
+  if(this->mux != I2CIP_MUX_NUM_FAKE) Clock::vote(this->wire, I2CIP_MUX_MAX_CLOCK); // The MUX sees all traffic on its wire
 }
 
 // Module::Module(const i2cip_fqa_t& eeprom_fqa) : Module(I2CIP_FQA_SEG_I2CBUS(eeprom_fqa), I2CIP_FQA_SEG_MODULE(eeprom_fqa), I2CIP_EEPROM_ADDR) { }
@@ -226,36 +305,69 @@ Module::~Module() {
     I2CIP_DEBUG_SERIAL.println(F("~Module()"));
     DEBUG_DELAY();
   #endif
+
+  if(this->mux != I2CIP_MUX_NUM_FAKE) Clock::unvote(this->wire, I2CIP_MUX_MAX_CLOCK);
 }
 
-void Module::toJSON(JsonObject obj, bool pingFilter) const {
+// Ping-filtered devices still waiting on their probe
+typedef struct {
+  Device* device;
+  i2cip_probe_t probe;
+} i2cip_pending_json_t;
+
+// Poll pending probes round-robin until at most `keep` remain; settled devices are written (if they answered)
+static void _drainProbes(JsonStream& json, i2cip_pending_json_t pending[], uint8_t& numpending, uint8_t keep) {
+  while(numpending > keep) {
+    for(uint8_t i = 0; i < numpending; ) {
+      if(!Device::probePoll(pending[i].probe)) { i++; continue; }
+      if(pending[i].probe.errlev == I2CIP_ERR_NONE) {
+        json.value(pending[i].device->getFQA());
+      } else if(pending[i].probe.errlev == I2CIP_ERR_HARD) {
+        pending[i].device->unready();
+      }
+      pending[i] = pending[--numpending];
+    }
+    if(numpending > keep) Device::idle();
+  }
+}
+
+void Module::toJSON(JsonStream& json, bool pingFilter) const {
+  i2cip_pending_json_t pending[I2CIP_MODULE_PROBES];
+  uint8_t numpending = 0;
+
+  json.beginObject();
   for(uint8_t i = 0; i < HASHTABLE_SLOTS; i++) {
     HashTableEntry<DeviceGroup>* ptr = this->devicegroups.hashtable[i];
-    do{
-      if(ptr != nullptr) {
-        DeviceGroup* group = ptr->value;
-        if(group == nullptr) continue;
-        if(group->getNumDevices() == 0) {
-          ptr = ptr->next;
-          continue; // Skip empty groups
-        }
-        JsonArray arr = obj[group->key].to<JsonArray>();
-        for(uint8_t j = 0; j < group->getNumDevices(); j++) {
-          Device* d = group->getDevice(j);
-          if(d != nullptr) {
-            if(pingFilter) {
-              i2cip_errorlevel_t errlev = d->pingTimeout();
-              if(errlev != I2CIP_ERR_NONE) {
-                continue; // Skip devices that are not pingable
-              }
-            }
-            arr.add(d->getFQA());
+    while(ptr != nullptr) {
+      DeviceGroup* group = ptr->value;
+      ptr = ptr->next;
+      if(group == nullptr || group->getNumDevices() == 0) continue; // Skip empty groups
+
+      json.key(group->key).beginArray();
+      for(uint8_t j = 0; j < group->getNumDevices(); j++) {
+        Device* d = group->getDevice(j);
+        if(d == nullptr) continue;
+        if(pingFilter) {
+          // Start probe; busy devices are polled alongside the rest of the group instead of blocking
+          if(numpending == I2CIP_MODULE_PROBES) _drainProbes(json, pending, numpending, I2CIP_MODULE_PROBES - 1);
+          i2cip_pending_json_t& p = pending[numpending];
+          if(!Device::probeStart(p.probe, d->getFQA(), true, true, I2CIP_DEVICE_TIMEOUT, true)) {
+            p.device = d;
+            numpending++;
+            continue;
+          }
+          if(p.probe.errlev != I2CIP_ERR_NONE) {
+            if(p.probe.errlev == I2CIP_ERR_HARD) d->unready();
+            continue; // Skip devices that are not pingable
           }
         }
-        ptr = ptr->next;
+        json.value(d->getFQA());
       }
-    } while(ptr != nullptr);
+      _drainProbes(json, pending, numpending, 0); // The group's array is closed before the next is opened
+      json.endArray();
+    }
   }
+  json.endObject();
 }
 
 // DeviceGroup* Module::deviceGroupFactory(const i2cip_id_t& id) {
@@ -268,74 +380,83 @@ void Module::toJSON(JsonObject obj, bool pingFilter) const {
 //   return nullptr;
 // }
 
-i2cip_errorlevel_t Module::discoverEEPROM(bool recurse) {
+bool Module::addEEPROM(void) {
+  if(this->eeprom_added) return true;
+
   #ifdef I2CIP_DEBUG_SERIAL
     DEBUG_DELAY();
-    I2CIP_DEBUG_SERIAL.print(F("-> Module "));
-    I2CIP_DEBUG_SERIAL.print(getModuleNum(), HEX);
-    I2CIP_DEBUG_SERIAL.print(F(" Discovering...\n"));
+    I2CIP_DEBUG_SERIAL.print(F("-> First-Time EEPROM Addition @0x"));
+    I2CIP_DEBUG_SERIAL.println((uintptr_t)eeprom, HEX);
     DEBUG_DELAY();
   #endif
-
-  if(I2CIP_FQA_SEG_MODULE(this->eeprom->getFQA()) == I2CIP_MUX_NUM_FAKE) {
+  bool r = this->add(this->eeprom, true);
+  if(!r) {
     #ifdef I2CIP_DEBUG_SERIAL
       DEBUG_DELAY();
-      I2CIP_DEBUG_SERIAL.print(F("Invalid Fake Module Rejected\n"));
+      I2CIP_DEBUG_SERIAL.println(F("-> ABORT!"));
       DEBUG_DELAY();
     #endif
-    return I2CIP_ERR_HARD;
+    return false;
   }
+  #ifdef I2CIP_DEBUG_SERIAL
+    else {
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.println(F("-> EEPROM Self-Add Success"));
+      DEBUG_DELAY();
+    }
+  #endif
 
-  // 1. EEPROM MODULE OOP
-
-  if(!this->eeprom_added) { 
+  Device** temp = I2CIP::devicetree[this->eeprom->getFQA()];
+  // r = (temp != nullptr && *temp == this->eeprom);
+  r = (temp != nullptr && *temp != nullptr && EEPROM::getID() != nullptr && EEPROM::getID()[0] != '\0' && strcmp((*temp)->getID(), EEPROM::getID()) == 0); // TODO: THIS MIGHT BE A PROBLEM
 
+  if(!r) {
     #ifdef I2CIP_DEBUG_SERIAL
       DEBUG_DELAY();
-      I2CIP_DEBUG_SERIAL.print(F("-> First-Time EEPROM Addition @0x"));
-      I2CIP_DEBUG_SERIAL.println((uintptr_t)eeprom, HEX);
+      I2CIP_DEBUG_SERIAL.print(F("-> FQA LOOKUP EEPROM* MISMATCH: "));
+      I2CIP_DEBUG_SERIAL.print((uintptr_t)temp, HEX);
+      I2CIP_DEBUG_SERIAL.print(" != ");
+      I2CIP_DEBUG_SERIAL.println((uintptr_t)this->eeprom, HEX);
       DEBUG_DELAY();
     #endif
-    bool r = this->add(this->eeprom, true);
-    if(!r) {
-      #ifdef I2CIP_DEBUG_SERIAL
-        DEBUG_DELAY();
-        I2CIP_DEBUG_SERIAL.println(F("-> ABORT!"));
-        DEBUG_DELAY();
-      #endif
-      return I2CIP_ERR_SOFT;
-    }
-    #ifdef I2CIP_DEBUG_SERIAL
-      else {
-        DEBUG_DELAY();
-        I2CIP_DEBUG_SERIAL.println(F("-> EEPROM Self-Add Success"));
-        DEBUG_DELAY();
-      }
-    #endif
+    return false;
+  }
 
-    Device** temp = I2CIP::devicetree[this->eeprom->getFQA()];
-    // r = (temp != nullptr && *temp == this->eeprom);
-    r = (temp != nullptr && *temp != nullptr && EEPROM::getID() != nullptr && EEPROM::getID()[0] != '\0' && strcmp((*temp)->getID(), EEPROM::getID()) == 0); // TODO: THIS MIGHT BE A PROBLEM
+  this->eeprom_added = true;
+  return true;
+}
 
-    if(!r) {
-      #ifdef I2CIP_DEBUG_SERIAL
-        DEBUG_DELAY();
-        I2CIP_DEBUG_SERIAL.print(F("-> FQA LOOKUP EEPROM* MISMATCH: "));
-        I2CIP_DEBUG_SERIAL.print((uintptr_t)temp, HEX);
-        I2CIP_DEBUG_SERIAL.print(" != ");
-        I2CIP_DEBUG_SERIAL.println((uintptr_t)this->eeprom, HEX);
-        DEBUG_DELAY();
-      #endif
-      return I2CIP_ERR_SOFT;
-    }
+i2cip_errorlevel_t Module::discoverEEPROM(bool recurse) {
+  I2CIP_TRACE(I2CIP_TRACE_MODULE_DISCOVER, this->eeprom->getFQA(), recurse);
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> Module "));
+    I2CIP_DEBUG_SERIAL.print(getModuleNum(), HEX);
+    I2CIP_DEBUG_SERIAL.print(F(" Discovering...\n"));
+    DEBUG_DELAY();
+  #endif
 
-    this->eeprom_added = true;
+  if(I2CIP_FQA_SEG_MODULE(this->eeprom->getFQA()) == I2CIP_MUX_NUM_FAKE) {
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.print(F("Invalid Fake Module Rejected\n"));
+      DEBUG_DELAY();
+    #endif
+    return I2CIP_ERR_HARD;
   }
 
+  // 1. EEPROM MODULE OOP
+  if(!this->addEEPROM()) return I2CIP_ERR_SOFT;
+
   
   // 2. SELF CHECK MUX & EEPROM
   if(!MUX::pingMUX(this->wire, this->mux) || eeprom == nullptr || eeprom->getInput() == nullptr) return I2CIP_ERR_HARD; // REBUILD PLZ
 
+  #ifdef I2CIP_MODULES_USE_TOPOLOGY
+    // 3a. FAST REATTACH - CHECKSUM TRAILER MATCHES CACHED TOPOLOGY
+    if(this->restoreTopology()) return I2CIP_ERR_NONE;
+  #endif
+
   // 3. READ EEPROM CONTENTS
   const uint16_t len = I2CIP_EEPROM_SIZE;
   i2cip_errorlevel_t errlev = eeprom->getInput()->get(&len);
@@ -374,7 +495,12 @@ i2cip_errorlevel_t Module::discoverEEPROM(bool recurse) {
 
   // Parse EEPROM contents into module devices
   bool r = parseEEPROMContents(eeprom->getCache());
-  if(r) return errlev; // All done
+  if(r) {
+    #ifdef I2CIP_MODULES_USE_TOPOLOGY
+      this->cacheTopology(eeprom->getCache());
+    #endif
+    return errlev; // All done
+  }
   else if (recurse) {
     // BAD EEPROM CONTENT - OVERWRITE WITH FAILSAFE
     #ifdef I2CIP_DEBUG_SERIAL
@@ -396,6 +522,109 @@ i2cip_errorlevel_t Module::discoverEEPROM(bool recurse) {
   }
 }
 
+#ifdef I2CIP_MODULES_USE_TOPOLOGY
+bool Module::restore(void) {
+  if(I2CIP_FQA_SEG_MODULE(this->eeprom->getFQA()) == I2CIP_MUX_NUM_FAKE) return false;
+  if(!Topology::valid(I2CIP::topologies[this->wire][this->mux], this->wire)) return false;
+  if(!this->addEEPROM()) return false;
+
+  // Trust the snapshot now; self-check verifies the trailer later
+  this->unverified = this->restoreTopology(false);
+  return this->unverified;
+}
+
+bool Module::restoreTopology(bool verify) {
+  i2cip_topology_t& topo = I2CIP::topologies[this->wire][this->mux];
+  if(!Topology::valid(topo, this->wire)) return false;
+
+  // 1. Cheap check: trailer only
+  i2cip_errorlevel_t errlev = I2CIP_ERR_NONE;
+  if(verify) {
+    errlev = this->eeprom->verifyChecksum(topo.len, topo.crc, true);
+    MUX::resetBus(this->eeprom->getFQA());
+  }
+  if(errlev != I2CIP_ERR_NONE) {
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.println(F("-> Cached Topology Stale; Rediscovering"));
+      DEBUG_DELAY();
+    #endif
+    Topology::clear(topo);
+    return false;
+  }
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> Restoring Cached Topology ("));
+    I2CIP_DEBUG_SERIAL.print(topo.numdevices);
+    I2CIP_DEBUG_SERIAL.println(F(" Devices)"));
+    DEBUG_DELAY();
+  #endif
+
+  // 2. Re-create devices as the parser would have
+  for(uint8_t i = 0; i < topo.numdevices; i++) {
+    DeviceGroup* dg = this->operator[](topo.ids[topo.devices[i].group]);
+    if(dg == nullptr) { Topology::clear(topo); return false; } // Library missing; let the parser report it
+    Device* d = (*dg)(topo.devices[i].fqa);
+    if(d == nullptr) continue; // Factory failed; same as parser
+    if(!this->add(d)) { Topology::clear(topo); return false; }
+  }
+  return true;
+}
+
+void Module::cacheTopology(const char* contents) {
+  i2cip_topology_t& topo = I2CIP::topologies[this->wire][this->mux];
+  #ifdef I2CIP_TOPOLOGY_USE_SNAPSHOT
+    const uint16_t prevcrc = Topology::valid(topo, this->wire) ? topo.crc : 0;
+    const uint8_t prevdevices = topo.numdevices;
+  #endif
+  Topology::clear(topo);
+  if(contents == nullptr) return;
+
+  size_t len = strlen(contents);
+  if(len == 0 || len + I2CIP_TOPOLOGY_TRAILER > I2CIP_EEPROM_SIZE) return; // No room for a trailer
+
+  // 1. Describe every device on this module's subnet, except its own EEPROM
+  for(uint8_t g = 0; g < HASHTABLE_SLOTS; g++) {
+    for(HashTableEntry<DeviceGroup>* entry = this->devicegroups.hashtable[g]; entry != nullptr; entry = entry->next) {
+      DeviceGroup* group = entry->value;
+      if(group == nullptr) continue;
+      for(uint8_t i = 0; i < group->numdevices; i++) {
+        Device* d = group->devices[i];
+        if(d == nullptr || d == this->eeprom || !I2CIP_FQA_MODULE_MATCH(d->getFQA(), this->wire, this->mux)) continue;
+        if(!Topology::addDevice(topo, d->getFQA(), group->key)) { Topology::clear(topo); return; } // Too big to cache
+      }
+    }
+  }
+
+  // 2. Key by content CRC; stamp trailer if it doesn't already match
+  uint16_t crc = crc16((const uint8_t*)contents, len);
+  if(this->eeprom->verifyChecksum(len, crc, true) != I2CIP_ERR_NONE && this->eeprom->writeChecksum(len, crc, true) != I2CIP_ERR_NONE) {
+    MUX::resetBus(this->eeprom->getFQA());
+    return; // Couldn't stamp; don't cache
+  }
+  MUX::resetBus(this->eeprom->getFQA());
+
+  topo.len = (uint16_t)len;
+  topo.crc = crc;
+  topo.wire = this->wire;
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> Topology Cached (CRC 0x"));
+    I2CIP_DEBUG_SERIAL.print(crc, HEX);
+    I2CIP_DEBUG_SERIAL.print(F(", "));
+    I2CIP_DEBUG_SERIAL.print(topo.numdevices);
+    I2CIP_DEBUG_SERIAL.println(F(" Devices)"));
+    DEBUG_DELAY();
+  #endif
+
+  #ifdef I2CIP_TOPOLOGY_USE_SNAPSHOT
+    if(crc != prevcrc || topo.numdevices != prevdevices) Snapshot::save(); // Only write flash on change
+  #endif
+}
+#endif
+
 // bool Module::add(Device& device) { // Subnet match check
 //   if(this->isFQAinSubnet(device.getFQA()) && (*this)[device.getFQA()] != nullptr) return true;
 //   return false;
@@ -836,6 +1065,29 @@ bool Module::add(Device* device, bool overwrite) {
 //   return true;
 // }
 
+i2cip_errorlevel_t Module::broadcast(i2cip_id_t id, const void* value, const void* args) {
+  DeviceGroup* group = this->devicegroups[id];
+  if(group == nullptr) return I2CIP_ERR_SOFT;
+  return group->broadcast(value, args);
+}
+
+i2cip_errorlevel_t Module::poll(void) {
+  i2cip_errorlevel_t worst = I2CIP_ERR_NONE;
+  for(uint8_t i = 0; i < HASHTABLE_SLOTS; i++) {
+    for(HashTableEntry<DeviceGroup>* ptr = this->devicegroups.hashtable[i]; ptr != nullptr; ptr = ptr->next) {
+      DeviceGroup* group = ptr->value;
+      if(group == nullptr) continue;
+      for(uint8_t j = 0; j < group->getNumDevices(); j++) {
+        Device* d = group->getDevice(j);
+        if(d == nullptr || d->getInput() == nullptr || d == this->eeprom) continue;
+        i2cip_errorlevel_t errlev = d->poll();
+        if(errlev > worst) worst = errlev;
+      }
+    }
+  }
+  return worst;
+}
+
 DeviceGroup* Module::operator[](i2cip_id_t id) {
   #ifdef I2CIP_DEBUG_SERIAL
     DEBUG_DELAY();
@@ -992,6 +1244,26 @@ i2cip_errorlevel_t Module::operator()(void) {
     }
   }
 
+  #ifdef I2CIP_MODULES_USE_TOPOLOGY
+    // 2. Background verify of a snapshot-restored topology
+    if(this->unverified) {
+      i2cip_topology_t& topo = I2CIP::topologies[this->wire][this->mux];
+      i2cip_errorlevel_t errlev = this->eeprom->verifyChecksum(topo.len, topo.crc, true);
+      MUX::resetBus(this->eeprom->getFQA());
+      if(errlev != I2CIP_ERR_HARD) this->unverified = false; // Else not ready yet; try again next self-check
+      if(errlev == I2CIP_ERR_SOFT) {
+        #ifdef I2CIP_DEBUG_SERIAL
+          DEBUG_DELAY();
+          I2CIP_DEBUG_SERIAL.print(F("Snapshot Topology Stale! Rebuilding Module...\n"));
+          DEBUG_DELAY();
+        #endif
+        Topology::clear(topo);
+        this->unready();
+        return I2CIP_ERR_HARD; // Rebuild from EEPROM
+      }
+    }
+  #endif
+
   // 3. Ping EEPROM until ready
   return this->eeprom->pingTimeout(true, true);
 }
@@ -1093,7 +1365,7 @@ i2cip_errorlevel_t I2CIP::Module::operator()(Device* d, bool update, i2cip_args_
   bool doOutput = (d->getOutput() != nullptr) && (args.s != nullptr || args.b != nullptr);
   bool doInput = (d->getInput() != nullptr) && args.g;
 
-  unsigned long now = millis();
+  unsigned long now = micros();
   i2cip_errorlevel_t errlev = I2CIP_ERR_NONE;
   if(update) {
     errlev = MUX::setBus(fqa);
@@ -1122,7 +1394,7 @@ i2cip_errorlevel_t I2CIP::Module::operator()(Device* d, bool update, i2cip_args_
     errlev = d->pingTimeout(true);
   }
 
-  unsigned long delta = millis() - now;
+  unsigned long delta = micros() - now;
 
   // if(out.peek() == 37) return errlev; // Probabaly NullStream; Refer
 
@@ -1134,7 +1406,7 @@ i2cip_errorlevel_t I2CIP::Module::operator()(Device* d, bool update, i2cip_args_
   }
   m += (' ');
   m += String(delta / 1000.0, 3);
-  m += ('s');
+  m += F("ms");
 
   if(update && errlev == I2CIP_ERR_NONE) {
     if(doInput) {
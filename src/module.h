@@ -11,6 +11,8 @@
 #include "device.h"
 #include "interface.h"
 #include "eeprom.h"
+#include "topology.h"
+#include "jsonstream.h"
 
 #include "bst.h"
 #include "hashtable.h"
@@ -19,6 +21,8 @@
 #define I2CIP_FQA_MODULE_MATCH(fqa, wire, module) (bool)(I2CIP_FQA_SEG_I2CBUS(fqa) == (wire) && I2CIP_FQA_SEG_MODULE(fqa) == (module))
 #define I2CIP_FQA_BUSADR_MATCH(fqa, bus, addr) (bool)(I2CIP_FQA_SEG_MUXBUS(fqa) == (bus) && I2CIP_FQA_SEG_DEVADR(fqa) == (addr))
 
+#define I2CIP_MODULE_PROBES 4 // Max concurrent readiness probes in a ping-filtered `Module::toJSON()`
+
 // 0. Forward Declarations and Global Variables
 namespace I2CIP { 
   class Module; class DeviceGroup;
@@ -106,6 +110,20 @@ namespace I2CIP {
        * @return A pointer to the instantiated device
        */
       Device* operator()(i2cip_fqa_t fqa);
+
+      // 2D. Group Output
+
+      /**
+       * Broadcast Write
+       * Devices sharing a wire, MUX, and address (i.e. the same part on different channels) are written once, with every channel selected at once.
+       * The remaining devices in the batch have their cached output mirrored instead of being written; devices that cannot share a transaction are `set()` individually.
+       * @note Write-only: reads with several channels selected collide on the bus, so only classes that opt in (`I2CIP_DEVICE_USE_BROADCAST()`) are broadcast, verification is skipped while the session is open,
+       * and devices that are not yet ready are begun (and set) individually.
+       * @param value Value to set (`nullptr` is not broadcast; every device is reset individually)
+       * @param args Set arguments (`nullptr`: failsafe arguments)
+       * @return Worst error level across all devices
+       */
+      i2cip_errorlevel_t broadcast(const void* value, const void* args = nullptr);
   };
 
   /**
@@ -122,6 +140,15 @@ namespace I2CIP {
       HashTable<DeviceGroup> devicegroups = HashTable<DeviceGroup>(); // HashTable of DeviceGroup* by ID
 
       bool eeprom_added = false; // Has this module's EEPROM been added to the DeviceGroup HashTable?
+      #ifdef I2CIP_MODULES_USE_TOPOLOGY
+      bool unverified = false; // Devices were restored from a snapshot without checking the EEPROM trailer
+      #endif
+
+      /**
+       * 3A-0. Add this module's EEPROM to its own DeviceGroup HashTable and the global BST (sets `eeprom_added`).
+       * @return `true` if the EEPROM was added and found in the BST
+       */
+      bool addEEPROM(void);
 
       /**
        * 3A. Check if the given FQA is a part of this module's subnetwork.
@@ -138,6 +165,21 @@ namespace I2CIP {
        */
       DeviceGroup* addEmptyGroup(const char* id);
 
+      #ifdef I2CIP_MODULES_USE_TOPOLOGY
+      /**
+       * 3B-2. Fast reattach. If a topology for this module slot is cached and the EEPROM checksum trailer still matches it, re-create its devices without reading or parsing the EEPROM.
+       * @param verify Whether to check the EEPROM trailer first (Default: `true`); if `false`, no I/O is performed
+       * @return `true` if the topology was verified and restored
+       */
+      bool restoreTopology(bool verify = true);
+
+      /**
+       * 3B-3. Describe this module's current devices in the topology cache, keyed by the CRC of `contents`; stamp the EEPROM checksum trailer if missing.
+       * @param contents EEPROM contents the devices were parsed from (null-terminated)
+       */
+      void cacheTopology(const char* contents);
+      #endif
+
     protected:
       EEPROM* const eeprom; // This module's EEPROM device
       
@@ -177,7 +219,12 @@ namespace I2CIP {
       inline operator EEPROM&() const { return *this->eeprom; }
 
       String toString(void) const { return this->devicegroups.toString(); }
-      void toJSON(JsonObject obj, bool pingFilter = false) const;
+      /**
+       * Write this module's devices as `{ "id": [fqa, ...], ... }`, streamed (constant memory).
+       * @param json Stream to write the object to
+       * @param pingFilter Only include devices that answer a readiness probe; busy devices in a group are probed concurrently (Default: `false`)
+       */
+      void toJSON(JsonStream& json, bool pingFilter = false) const;
 
       /**
        * DeviceGroup Lookup
@@ -187,6 +234,25 @@ namespace I2CIP {
       */
       DeviceGroup* operator[](i2cip_id_t id);
 
+      /**
+       * Broadcast a `set` to every device in the DeviceGroup with the given ID.
+       * @see `DeviceGroup::broadcast()`
+       * @return `I2CIP_ERR_SOFT` if no such group exists; otherwise the worst error level across the group
+       */
+      i2cip_errorlevel_t broadcast(i2cip_id_t id, const void* value, const void* args = nullptr);
+
+      /**
+       * @return This module's DeviceGroup with the given ID, or `nullptr` (unlike `operator[]`, never creates one)
+       */
+      DeviceGroup* find(i2cip_id_t id) { return this->devicegroups[id]; }
+
+      /**
+       * Read every due input in this module (see `Device::poll()`), with each input's last args; inputs bound to an interrupt are skipped until their line fires or their safety poll lapses.
+       * The EEPROM is not polled (it is read by the self-check).
+       * @return Worst error level of the reads performed
+       */
+      i2cip_errorlevel_t poll(void);
+
       // 3E. Network Operations
 
       /**
@@ -213,6 +279,16 @@ namespace I2CIP {
        */
       virtual bool parseEEPROMContents(const char* contents) { return true; }
 
+      #ifdef I2CIP_MODULES_USE_TOPOLOGY
+      /**
+       * Cold-Boot Restore
+       * Bring this module's devices online from the cached topology (e.g. loaded by `Snapshot::load()`) without touching the bus.
+       * The EEPROM trailer is verified on the next self-check; if it no longer matches, the self-check fails `I2CIP_ERR_HARD` so the module is rebuilt.
+       * @return `true` if a cached topology existed for this module and was restored
+       */
+      bool restore(void);
+      #endif
+
 
     #ifdef DEBUG_SERIAL
     public:
@@ -1,5 +1,6 @@
 #include "mux.h"
 
+#include "clock.h"
 #include "debug_i2cip.h"
 
 // #define I2CIP_DEBUG_SERIAL Serial // just this once
@@ -9,6 +10,14 @@
 
 // It's ok to have this globally bc it's a microcontroller
 bool _busses_reset = false;
+
+// Broadcast session masks (0: none)
+static uint8_t _broadcast[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT] = { { 0 } };
+// Held bus per MUX (bus + 1; 0: none; I2CIP_MUX_HELD_UNKNOWN: held, but the selection is not a single known bus)
+static uint8_t _held[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT] = { { 0 } };
+#define I2CIP_MUX_HELD_UNKNOWN 0xFF
+// While held, track what the MUX actually has selected so a held bus is never assumed selected after another was
+static void _track(uint8_t wire, uint8_t m, uint8_t held) { if(wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && _held[wire][m] != 0) _held[wire][m] = held; }
 I2CIP::i2cip_errorlevel_t resetBusses(uint8_t wire) {
   I2CIP::i2cip_errorlevel_t errlev = I2CIP::I2CIP_ERR_NONE;
   for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
@@ -112,6 +121,8 @@ namespace I2CIP {
         FAKEMUX_BREAK(nofqa);
       #endif
 
+      if(wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && _held[wire][m] == bus + 1) return I2CIP_ERR_NONE; // Already selected
+
       #ifdef I2CIP_DEBUG_SERIAL
         I2CIP_DEBUG_SERIAL.print(F("-> MUX "));
         I2CIP_DEBUG_SERIAL.print(m, HEX);
@@ -130,10 +141,13 @@ namespace I2CIP {
       // Begin transmission
       I2CIP_WIRES(wire)->beginTransmission(I2CIP_MODULE_TO_MUXADDR(m));
 
-      // Write the bus switch instruction
+      // Write the bus switch instruction (whole broadcast mask if this bus is part of a session)
       uint8_t instruction = I2CIP_MUX_BUS_TO_INSTR(bus);
+      if(wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && (_broadcast[wire][m] & instruction)) instruction = _broadcast[wire][m];
+      I2CIP_TRACE(I2CIP_TRACE_MUX_SET, nofqa, instruction);
       if (I2CIP_WIRES(wire)->write(&instruction, 1) != 1) {
         success = false;
+        I2CIP_TRACE(I2CIP_TRACE_MUX_FAIL, nofqa, I2CIP_ERR_SOFT);
 
         #ifdef I2CIP_DEBUG_SERIAL
           DEBUG_DELAY();
@@ -143,6 +157,8 @@ namespace I2CIP {
 
       // End transmission
       if (I2CIP_WIRES(wire)->endTransmission(true) != 0) {
+        _track(wire, m, I2CIP_MUX_HELD_UNKNOWN);
+        I2CIP_TRACE(I2CIP_TRACE_MUX_FAIL, nofqa, I2CIP_ERR_HARD);
         #ifdef I2CIP_DEBUG_SERIAL
           I2CIP_DEBUG_SERIAL.println(F("FAIL EIO"));
           DEBUG_DELAY();
@@ -155,6 +171,9 @@ namespace I2CIP {
         DEBUG_DELAY();
       #endif
 
+      _track(wire, m, (success && instruction == I2CIP_MUX_BUS_TO_INSTR(bus)) ? bus + 1 : I2CIP_MUX_HELD_UNKNOWN);
+      if(success) Clock::select(wire, m, instruction); // Retune for the newly-connected channel(s)
+
       return (success ? I2CIP_ERR_NONE : I2CIP_ERR_SOFT);
     }
 
@@ -187,6 +206,10 @@ namespace I2CIP {
         }
       #endif
 
+      if(wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && _held[wire][m] != 0) return I2CIP_ERR_NONE; // Deferred until release()
+
+      I2CIP_TRACE(I2CIP_TRACE_MUX_RESET, nofqa, 0);
+
       #ifdef I2CIP_DEBUG_SERIAL
         I2CIP_DEBUG_SERIAL.print(F("-> MUX "));
         I2CIP_DEBUG_SERIAL.print(m, HEX);
@@ -203,6 +226,7 @@ namespace I2CIP {
       // Write the "inactive" bus switch instruction
       const uint8_t instruction = I2CIP_MUX_INSTR_RST;
       if (I2CIP_WIRES(wire)->write(&instruction, 1) != 1) {
+        I2CIP_TRACE(I2CIP_TRACE_MUX_FAIL, nofqa, I2CIP_ERR_SOFT);
         #ifdef I2CIP_DEBUG_SERIAL
           I2CIP_DEBUG_SERIAL.println(F("FAIL EINVAL"));
         #endif
@@ -211,6 +235,7 @@ namespace I2CIP {
 
       // End transmission
       if (I2CIP_WIRES(wire)->endTransmission(true) != 0) {
+        I2CIP_TRACE(I2CIP_TRACE_MUX_FAIL, nofqa, I2CIP_ERR_HARD);
         #ifdef I2CIP_DEBUG_SERIAL
           I2CIP_DEBUG_SERIAL.println(F("FAIL EIO"));
         #endif
@@ -221,7 +246,52 @@ namespace I2CIP {
         I2CIP_DEBUG_SERIAL.println(F("PASS"));
       #endif
 
+      Clock::select(wire, m, I2CIP_MUX_INSTR_RST);
+
       return I2CIP_ERR_NONE;
     }
+
+    i2cip_errorlevel_t beginBroadcast(const uint8_t& wire, const uint8_t& m, const uint8_t& mask) {
+      if(wire >= I2CIP_NUM_WIRES || m >= I2CIP_MUX_COUNT || m == I2CIP_MUX_NUM_FAKE) return I2CIP_ERR_SOFT;
+      uint8_t bits = mask & ~I2CIP_MUX_BUS_TO_INSTR(I2CIP_MUX_BUS_FAKE); // Fake bus is not a channel
+      if(bits == 0) return I2CIP_ERR_SOFT;
+
+      // Lowest bus in the mask; setBus expands it to the whole session
+      uint8_t bus = 0;
+      while(!(bits & I2CIP_MUX_BUS_TO_INSTR(bus))) bus++;
+
+      _broadcast[wire][m] = bits;
+      i2cip_errorlevel_t errlev = setBus(wire, m, bus);
+      if(errlev != I2CIP_ERR_NONE) _broadcast[wire][m] = 0;
+      return errlev;
+    }
+
+    i2cip_errorlevel_t endBroadcast(const uint8_t& wire, const uint8_t& m) {
+      if(wire >= I2CIP_NUM_WIRES || m >= I2CIP_MUX_COUNT) return I2CIP_ERR_SOFT;
+      _broadcast[wire][m] = 0;
+      return resetBus(wire, m);
+    }
+
+    bool broadcasting(const i2cip_fqa_t& fqa) {
+      uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa), m = I2CIP_FQA_SEG_MODULE(fqa);
+      return wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && _broadcast[wire][m] != 0;
+    }
+
+    i2cip_errorlevel_t hold(const i2cip_fqa_t& fqa) {
+      uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa), m = I2CIP_FQA_SEG_MODULE(fqa), bus = I2CIP_FQA_SEG_MUXBUS(fqa);
+      i2cip_errorlevel_t errlev = setBus(fqa);
+      if(errlev == I2CIP_ERR_NONE && wire < I2CIP_NUM_WIRES && m < I2CIP_MUX_COUNT && m != I2CIP_MUX_NUM_FAKE && bus != I2CIP_MUX_BUS_FAKE) {
+        _held[wire][m] = (_broadcast[wire][m] & I2CIP_MUX_BUS_TO_INSTR(bus)) ? I2CIP_MUX_HELD_UNKNOWN : bus + 1; // Broadcast: whole mask selected
+      }
+      return errlev;
+    }
+
+    i2cip_errorlevel_t release(const i2cip_fqa_t& fqa) {
+      uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa), m = I2CIP_FQA_SEG_MODULE(fqa);
+      if(wire >= I2CIP_NUM_WIRES || m >= I2CIP_MUX_COUNT) return I2CIP_ERR_SOFT;
+      if(_held[wire][m] == 0) return I2CIP_ERR_NONE;
+      _held[wire][m] = 0;
+      return resetBus(wire, m);
+    }
   };
-};
\ No newline at end of file
+};
@@ -66,6 +66,40 @@ namespace I2CIP {
      */
     i2cip_errorlevel_t resetBus(const i2cip_fqa_t& fqa);
     i2cip_errorlevel_t resetBus(const uint8_t& wire, const uint8_t& m);
+
+    /**
+     * Begin a broadcast session: until `endBroadcast()`, any `setBus()` on this MUX to a bus in `mask` selects every bus in `mask` at once.
+     * Same-address devices on those buses all receive each write. Reads during a session will collide; write only.
+     * | MUX ADDR (7) | MUX CONFIG (mask) | ACK? |
+     * @param wire Wire number
+     * @param m MUX number
+     * @param mask Bitmask of buses (see `I2CIP_MUX_BUS_TO_INSTR`)
+     * @return Result of selecting `mask`
+     */
+    i2cip_errorlevel_t beginBroadcast(const uint8_t& wire, const uint8_t& m, const uint8_t& mask);
+
+    /**
+     * End a broadcast session and reset the MUX.
+     */
+    i2cip_errorlevel_t endBroadcast(const uint8_t& wire, const uint8_t& m);
+
+    /**
+     * @return `true` if a broadcast session is open on this FQA's MUX
+     */
+    bool broadcasting(const i2cip_fqa_t& fqa);
+
+    /**
+     * Hold a bus selected across several device transactions: until `release()`, `setBus()` to it is a NOP and `resetBus()` on this MUX is deferred.
+     * `setBus()` to another bus of this MUX meanwhile switches as usual (the hold follows it), and the held bus is re-selected on its next `setBus()`.
+     * @param fqa FQA of a device on the target Subnet (fake MUX/bus: selected as usual, not held)
+     * @return Result of selecting the bus
+     */
+    i2cip_errorlevel_t hold(const i2cip_fqa_t& fqa);
+
+    /**
+     * Release a held bus and reset the MUX.
+     */
+    i2cip_errorlevel_t release(const i2cip_fqa_t& fqa);
   };
 };
 
@@ -0,0 +1,24 @@
+#include "pool.h"
+
+using namespace I2CIP;
+
+// Globals
+PoolBase* PoolBase::head = nullptr;
+
+PoolBase::PoolBase(const char* name, uint16_t slotsize, uint8_t capacity) : name(name), slotsize(slotsize), capacity(capacity) {
+  // Register (prepend)
+  this->next = PoolBase::head;
+  PoolBase::head = this;
+}
+
+void PoolBase::toJSON(JsonArray arr) {
+  for(PoolBase* p = PoolBase::head; p != nullptr; p = p->next) {
+    JsonObject obj = arr.add<JsonObject>();
+    obj["name"] = p->name;
+    obj["size"] = p->slotsize;
+    obj["slots"] = p->capacity;
+    obj["used"] = p->used;
+    obj["highwater"] = p->highwater;
+    obj["overflows"] = p->overflows;
+  }
+}
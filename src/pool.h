@@ -0,0 +1,113 @@
+#ifndef I2CIP_POOL_H_
+#define I2CIP_POOL_H_
+
+#include <Arduino.h>
+
+#include <ArduinoJson.h>
+
+// ---------------------------------------
+// POOL: Fixed-Size Device Object Pools
+// ---------------------------------------
+// Each Device class gets a static array of N object-sized slots, threaded onto an intrusive free list.
+// Allocation and deallocation are O(1) and never touch the heap, so module hot-plug cycles reuse the same memory without fragmenting it.
+// When a pool runs dry the allocation overflows to the heap (and is counted), so exhaustion degrades to the old behaviour instead of failing.
+
+#define I2CIP_POOL_SLOTS_DEFAULT 8 // Default number of slots per Device class (overridable per class)
+
+namespace I2CIP {
+
+  /**
+   * Type-erased pool bookkeeping. Every pool registers itself in a global list on construction so that usage can be reported.
+   */
+  class PoolBase {
+    private:
+      static PoolBase* head; // Registry of all constructed pools
+      PoolBase* next = nullptr;
+
+    protected:
+      const char* const name;     // Pool owner (class name)
+      const uint16_t slotsize;    // Bytes per slot
+      const uint8_t capacity;     // Number of slots
+
+      uint8_t used = 0;           // Slots currently allocated
+      uint8_t highwater = 0;      // Most slots ever allocated at once
+      uint16_t overflows = 0;     // Allocations that fell back to the heap
+
+      PoolBase(const char* name, uint16_t slotsize, uint8_t capacity);
+
+    public:
+      const char* getName(void) const { return this->name; }
+      uint16_t getSlotSize(void) const { return this->slotsize; }
+      uint8_t getCapacity(void) const { return this->capacity; }
+      uint8_t getUsed(void) const { return this->used; }
+      uint8_t getHighWater(void) const { return this->highwater; }
+      uint16_t getOverflows(void) const { return this->overflows; }
+
+      /**
+       * Report every registered pool as `{ "name", "size", "slots", "used", "highwater", "overflows" }`.
+       * @param arr Array to append to
+       */
+      static void toJSON(JsonArray arr);
+
+      virtual void* allocate(void) = 0;
+      virtual void deallocate(void* ptr) = 0;
+      virtual bool owns(const void* ptr) const = 0;
+  };
+
+  /**
+   * Fixed-size object pool.
+   * @tparam SIZE Bytes per slot (`sizeof` the pooled class)
+   * @tparam ALIGN Slot alignment (`alignof` the pooled class)
+   * @tparam N Number of slots
+   */
+  template <size_t SIZE, size_t ALIGN, uint8_t N> class ObjectPool : public PoolBase {
+    static_assert(N > 0, "ObjectPool must have at least one slot.");
+    private:
+      union Slot {
+        Slot* next; // Free-list link (only while unallocated)
+        alignas(ALIGN) uint8_t storage[SIZE];
+      };
+
+      Slot slots[N];
+      Slot* freelist = nullptr;
+
+    public:
+      ObjectPool(const char* name);
+
+      /**
+       * Take a slot off the free list; falls back to the heap if exhausted.
+       * @return Pointer to uninitialized storage of at least SIZE bytes
+       */
+      void* allocate(void) override;
+
+      /**
+       * Return a slot to the free list, or free it to the heap if it did not come from this pool.
+       * @param ptr Pointer previously returned by `allocate()`
+       */
+      void deallocate(void* ptr) override;
+
+      /**
+       * @return `true` if `ptr` lies within this pool's slot array
+       */
+      bool owns(const void* ptr) const override;
+  };
+};
+
+// Pooled allocation for Device classes. Expands inside the class body; the pool is a function-local static, so no out-of-class definition is needed.
+#ifdef I2CIP_DEVICES_USE_POOLS
+#define I2CIP_DEVICE_USE_POOL(CLASS, SLOTS) \
+  private:\
+    static I2CIP::PoolBase& _pool(void) {\
+      static I2CIP::ObjectPool<sizeof(CLASS), alignof(CLASS), (SLOTS)> pool(#CLASS);\
+      return pool;\
+    }\
+  public:\
+    static void* operator new(size_t size) { return (size == sizeof(CLASS)) ? _pool().allocate() : ::operator new(size); }\
+    static void operator delete(void* ptr, size_t size) { if(size == sizeof(CLASS)) { _pool().deallocate(ptr); } else { ::operator delete(ptr); } }
+#else
+#define I2CIP_DEVICE_USE_POOL(CLASS, SLOTS)
+#endif
+
+#include "pool.tpp"
+
+#endif
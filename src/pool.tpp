@@ -0,0 +1,61 @@
+#ifndef I2CIP_POOL_H_
+#error __FILE__ should only be included AFTER <pool.h>
+#endif
+
+#ifdef I2CIP_POOL_H_
+
+#ifndef I2CIP_POOL_T_
+#define I2CIP_POOL_T_
+
+#include "debug_i2cip.h"
+
+template <size_t SIZE, size_t ALIGN, uint8_t N> I2CIP::ObjectPool<SIZE, ALIGN, N>::ObjectPool(const char* name) : PoolBase(name, sizeof(Slot), N) {
+  // Thread every slot onto the free list
+  for(uint8_t i = 0; i < N; i++) {
+    this->slots[i].next = (i + 1 < N) ? &this->slots[i + 1] : nullptr;
+  }
+  this->freelist = &this->slots[0];
+}
+
+template <size_t SIZE, size_t ALIGN, uint8_t N> void* I2CIP::ObjectPool<SIZE, ALIGN, N>::allocate(void) {
+  if(this->freelist == nullptr) {
+    // Exhausted; overflow to heap
+    this->overflows++;
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.print(F("Pool '"));
+      I2CIP_DEBUG_SERIAL.print(this->name);
+      I2CIP_DEBUG_SERIAL.println(F("' Exhausted; Heap Overflow"));
+      DEBUG_DELAY();
+    #endif
+    return ::operator new(SIZE);
+  }
+
+  Slot* slot = this->freelist;
+  this->freelist = slot->next;
+
+  this->used++;
+  if(this->used > this->highwater) this->highwater = this->used;
+
+  return (void*)slot->storage;
+}
+
+template <size_t SIZE, size_t ALIGN, uint8_t N> void I2CIP::ObjectPool<SIZE, ALIGN, N>::deallocate(void* ptr) {
+  if(ptr == nullptr) return;
+  if(!this->owns(ptr)) {
+    ::operator delete(ptr); // Overflowed allocation
+    return;
+  }
+
+  Slot* slot = (Slot*)ptr;
+  slot->next = this->freelist;
+  this->freelist = slot;
+  this->used--;
+}
+
+template <size_t SIZE, size_t ALIGN, uint8_t N> bool I2CIP::ObjectPool<SIZE, ALIGN, N>::owns(const void* ptr) const {
+  return ((const uint8_t*)ptr >= (const uint8_t*)&this->slots[0]) && ((const uint8_t*)ptr < (const uint8_t*)&this->slots[N]);
+}
+
+#endif
+#endif
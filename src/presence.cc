@@ -0,0 +1,108 @@
+#include "presence.h"
+
+#include "module.h"
+#include "recovery.h"
+#include "debug_i2cip.h"
+
+using namespace I2CIP;
+
+static i2cip_presence_t _presence[I2CIP_MUX_COUNT] = { }; // All due at boot
+static uint8_t _cursor = 0; // Round-robin resume point
+
+static inline bool _due(const i2cip_presence_t& slot, uint32_t now) { return (int32_t)(now - slot.next) >= 0; }
+
+static inline void _schedule(i2cip_presence_t& slot, uint32_t now, uint16_t interval) {
+  slot.interval = interval;
+  slot.next = now + interval;
+}
+
+void Presence::reset(void) {
+  uint32_t now = millis();
+  for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
+    _presence[m].next = now;
+    _presence[m].interval = I2CIP_PRESENCE_BACKOFF_MIN;
+  }
+  _cursor = 0;
+}
+
+void Presence::expedite(const i2cip_fqa_t& fqa) {
+  uint8_t m = I2CIP_FQA_SEG_MODULE(fqa);
+  if(m == I2CIP_MUX_NUM_FAKE || m >= I2CIP_MUX_COUNT) return;
+  _presence[m].next = millis();
+  _presence[m].interval = I2CIP_PRESENCE_BACKOFF_MIN;
+}
+
+uint32_t Presence::due(const uint8_t& module) {
+  if(module >= I2CIP_MUX_COUNT) return 0;
+  uint32_t now = millis();
+  return _due(_presence[module], now) ? 0 : (_presence[module].next - now);
+}
+
+uint8_t Presence::tick(const uint8_t& wire, i2cip_module_factory_t factory, uint32_t budget, uint8_t checks) {
+  const uint32_t start = micros();
+  uint8_t serviced = 0;
+
+  for(uint8_t i = 0; i < I2CIP_MUX_COUNT && serviced < checks; i++) {
+    uint8_t m = (_cursor + i) % I2CIP_MUX_COUNT;
+    i2cip_presence_t& slot = _presence[m];
+    uint32_t now = millis();
+    if(!_due(slot, now)) continue;
+    if(serviced > 0 && (micros() - start) >= budget) break; // Out of time; resume here next tick
+
+    serviced++;
+    _cursor = (m + 1) % I2CIP_MUX_COUNT;
+
+    // 1. Empty slot - cheap MUX ping only
+    if(I2CIP::modules[m] == nullptr) {
+      if(!MUX::pingMUX(wire, m) || factory == nullptr || (I2CIP::modules[m] = factory(wire, m)) == nullptr) {
+        I2CIP::errlev[m] = I2CIP_ERR_HARD;
+        uint32_t backoff = (uint32_t)slot.interval * 2;
+        _schedule(slot, now, (uint16_t)constrain(backoff, (uint32_t)I2CIP_PRESENCE_BACKOFF_MIN, (uint32_t)I2CIP_PRESENCE_BACKOFF_MAX));
+        continue;
+      }
+
+      #ifdef I2CIP_DEBUG_SERIAL
+        DEBUG_DELAY();
+        I2CIP_DEBUG_SERIAL.print(F("-> Presence: Module "));
+        I2CIP_DEBUG_SERIAL.print(m, HEX);
+        I2CIP_DEBUG_SERIAL.println(F(" Found"));
+        DEBUG_DELAY();
+      #endif
+    }
+
+    // 2. Full self-check (MUX ping, EEPROM discovery/ping)
+    I2CIP::errlev[m] = I2CIP::modules[m]->operator()();
+
+    #ifdef I2CIP_WIRES_USE_RECOVERY
+      // 2A. A stuck wire fails every module at once; recover it and re-check before tearing anything down
+      Recovery::report(createFQA(wire, m, 0, 0), I2CIP::errlev[m]);
+      if(I2CIP::errlev[m] == I2CIP_ERR_HARD && Recovery::stuck(wire) && Recovery::recover(wire)) {
+        I2CIP::errlev[m] = I2CIP::modules[m]->operator()();
+        Recovery::report(createFQA(wire, m, 0, 0), I2CIP::errlev[m]);
+      }
+    #endif
+
+    switch(I2CIP::errlev[m]) {
+      case I2CIP_ERR_NONE:
+        _schedule(slot, now, I2CIP_PRESENCE_INTERVAL);
+        break;
+      case I2CIP_ERR_SOFT:
+        _schedule(slot, now, I2CIP_PRESENCE_RETRY);
+        break;
+      default:
+        #ifdef I2CIP_DEBUG_SERIAL
+          DEBUG_DELAY();
+          I2CIP_DEBUG_SERIAL.print(F("-> Presence: Module "));
+          I2CIP_DEBUG_SERIAL.print(m, HEX);
+          I2CIP_DEBUG_SERIAL.println(F(" Lost"));
+          DEBUG_DELAY();
+        #endif
+        delete I2CIP::modules[m];
+        I2CIP::modules[m] = nullptr;
+        _schedule(slot, now, I2CIP_PRESENCE_BACKOFF_MIN);
+        break;
+    }
+  }
+
+  return serviced;
+}
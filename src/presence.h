@@ -0,0 +1,66 @@
+#ifndef I2CIP_PRESENCE_H_
+#define I2CIP_PRESENCE_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+#include "mux.h"
+
+// ------------------------------------------
+// PRESENCE: Budgeted Module Hot-Plug Scanning
+// ------------------------------------------
+// Each module slot carries its own due time. Known-good modules are self-checked every `I2CIP_PRESENCE_INTERVAL` ms;
+// empty slots are re-pinged with exponential backoff (`I2CIP_PRESENCE_BACKOFF_MIN` doubling to `I2CIP_PRESENCE_BACKOFF_MAX` ms).
+// `tick()` only services due slots, at most `checks` of them and only while inside its microsecond budget, resuming round-robin next call.
+// Any Device I/O error expedites its module's slot so the next tick runs a full self-check on it.
+
+#define I2CIP_PRESENCE_INTERVAL     1000  // ms between self-checks of a healthy module
+#define I2CIP_PRESENCE_RETRY        50    // ms until re-check of a module that reported SOFT
+#define I2CIP_PRESENCE_BACKOFF_MIN  50    // ms; first re-ping of an empty slot
+#define I2CIP_PRESENCE_BACKOFF_MAX  2000  // ms; backoff ceiling for an empty slot
+#define I2CIP_PRESENCE_BUDGET       2000  // us per tick (Default)
+#define I2CIP_PRESENCE_CHECKS       2     // Max slots serviced per tick (Default)
+
+namespace I2CIP {
+  class Module;
+
+  typedef Module* (*i2cip_module_factory_t)(const uint8_t& wire, const uint8_t& module);
+
+  typedef struct {
+    uint32_t next;      // millis() when this slot is next due
+    uint16_t interval;  // Current check interval (ms)
+  } i2cip_presence_t;
+
+  namespace Presence {
+    /**
+     * Make every slot due immediately (e.g. at boot).
+     */
+    void reset(void);
+
+    /**
+     * Service due module slots on `wire`, updating `I2CIP::modules[]` and `I2CIP::errlev[]`.
+     * i.   Existing module: `Module::operator()()`; `I2CIP_ERR_HARD` deletes it and starts backoff
+     * ii.  Empty slot: ping the MUX; if found, build with `factory` and self-check
+     * @param wire Wire number
+     * @param factory Module constructor for newly-found slots
+     * @param budget Microseconds after which no further slot is started (at least one due slot is always serviced)
+     * @param checks Max slots serviced
+     * @return Number of slots serviced
+     */
+    uint8_t tick(const uint8_t& wire, i2cip_module_factory_t factory, uint32_t budget = I2CIP_PRESENCE_BUDGET, uint8_t checks = I2CIP_PRESENCE_CHECKS);
+
+    /**
+     * Fast-path a module slot to a full self-check on the next tick.
+     * @param fqa Any FQA on the module (fake MUX is ignored)
+     */
+    void expedite(const i2cip_fqa_t& fqa);
+
+    /**
+     * @param module Module (MUX) number
+     * @return Milliseconds until the slot is due (0 if due)
+     */
+    uint32_t due(const uint8_t& module);
+  };
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "recovery.h"
+
+#include "mux.h"
+#include "clock.h"
+#include "debug_i2cip.h"
+
+#ifdef I2CIP_WIRES_USE_RECOVERY
+
+using namespace I2CIP;
+
+static int16_t _sda[I2CIP_NUM_WIRES] = { SDA };
+static int16_t _scl[I2CIP_NUM_WIRES] = { SCL };
+static bool _pinsInit = false;
+
+static uint8_t _failed[I2CIP_NUM_WIRES] = { 0 };  // Bitmask of modules with HARD errors since the last success
+static uint32_t _last[I2CIP_NUM_WIRES] = { 0 };   // millis() of the last recovery attempt
+static bool _tried[I2CIP_NUM_WIRES] = { false };
+static i2cip_recovery_stats_t _stats[I2CIP_NUM_WIRES] = { };
+
+static void _init(void) {
+  if(_pinsInit) return;
+  for(uint8_t w = 1; w < I2CIP_NUM_WIRES; w++) { _sda[w] = -1; _scl[w] = -1; }
+  _pinsInit = true;
+}
+
+static uint8_t _popcount(uint8_t x) { uint8_t n = 0; while(x) { n += (x & 1); x >>= 1; } return n; }
+
+// Open-drain emulation: drive low, or release to the pull-up
+static inline void _low(int16_t pin) { digitalWrite(pin, LOW); pinMode(pin, OUTPUT); }
+static inline void _release(int16_t pin) { pinMode(pin, INPUT_PULLUP); }
+
+void Recovery::setPins(uint8_t wire, int16_t sda, int16_t scl) {
+  if(wire >= I2CIP_NUM_WIRES) return;
+  _init();
+  _sda[wire] = sda;
+  _scl[wire] = scl;
+}
+
+void Recovery::report(const i2cip_fqa_t& fqa, i2cip_errorlevel_t errlev) {
+  uint8_t wire = I2CIP_FQA_SEG_I2CBUS(fqa);
+  if(wire >= I2CIP_NUM_WIRES) return;
+  if(errlev == I2CIP_ERR_NONE) { _failed[wire] = 0; return; }
+  if(errlev == I2CIP_ERR_HARD) _failed[wire] |= (1 << I2CIP_FQA_SEG_MODULE(fqa));
+}
+
+bool Recovery::stuck(uint8_t wire) {
+  if(wire >= I2CIP_NUM_WIRES) return false;
+  _init();
+  if(_popcount(_failed[wire]) >= I2CIP_RECOVERY_MODULES) return true;
+  // Idle bus with SDA low can only be a slave mid-byte
+  return (_sda[wire] >= 0 && wiresBegun[wire] && digitalRead(_sda[wire]) == LOW);
+}
+
+bool Recovery::recover(uint8_t wire) {
+  if(wire >= I2CIP_NUM_WIRES) return false;
+  _init();
+  uint32_t now = millis();
+  if(_tried[wire] && (now - _last[wire]) < I2CIP_RECOVERY_HOLDOFF) return false;
+  _tried[wire] = true;
+  _last[wire] = now;
+  _stats[wire].attempts++;
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.print(F("-> I2C WIRE "));
+    I2CIP_DEBUG_SERIAL.print(wire);
+    I2CIP_DEBUG_SERIAL.print(F(" STUCK; RECOVERING... "));
+    DEBUG_DELAY();
+  #endif
+
+  bool ok = true;
+  const int16_t sda = _sda[wire], scl = _scl[wire];
+  if(sda >= 0 && scl >= 0) {
+    if(wiresBegun[wire]) wires[wire]->end(); // Take the pins back from the peripheral
+
+    _release(sda);
+    _release(scl);
+    delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+
+    // 1. Clock out whatever byte the slave thinks it is sending (at most 9 bits incl. ACK)
+    for(uint8_t i = 0; i < 9 && digitalRead(sda) == LOW; i++) {
+      _low(scl);
+      delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+      _release(scl);
+      uint32_t t = micros();
+      while(digitalRead(scl) == LOW && (micros() - t) < I2CIP_RECOVERY_STRETCH) { } // Clock stretching
+      delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+    }
+
+    // 2. STOP: SDA rises while SCL is high
+    _low(scl);
+    delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+    _low(sda);
+    delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+    _release(scl);
+    delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+    _release(sda);
+    delayMicroseconds(I2CIP_RECOVERY_HALFCLK);
+
+    ok = (digitalRead(sda) == HIGH && digitalRead(scl) == HIGH);
+  }
+
+  // 3. Re-begin (re-applies the negotiated clock) and deselect every MUX; channels selected before the hang are unknown
+  wiresBegun[wire] = false;
+  ok = beginWire(wire) && ok;
+  if(ok) {
+    for(uint8_t m = 0; m < I2CIP_MUX_COUNT; m++) {
+      if(m != I2CIP_MUX_NUM_FAKE) MUX::resetBus(wire, m);
+    }
+    _stats[wire].recovered++;
+    _failed[wire] = 0;
+  }
+
+  I2CIP_TRACE(I2CIP_TRACE_RECOVERY, createFQA(wire, 0, 0, 0), ok);
+  #ifdef I2CIP_DEBUG_SERIAL
+    I2CIP_DEBUG_SERIAL.println(ok ? F("PASS") : F("FAIL"));
+    DEBUG_DELAY();
+  #endif
+  return ok;
+}
+
+const i2cip_recovery_stats_t& Recovery::stats(uint8_t wire) {
+  static const i2cip_recovery_stats_t none = { };
+  return (wire < I2CIP_NUM_WIRES) ? _stats[wire] : none;
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef I2CIP_RECOVERY_H_
+#define I2CIP_RECOVERY_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+
+// ---------------------------------------
+// RECOVERY: Stuck-Bus Detection & Clock-Pulse Recovery
+// ---------------------------------------
+// A slave that browns out or loses sync mid-read can hold SDA low indefinitely; every transaction on that wire then fails HARD,
+// which used to look like every module being unplugged at once. A wire is considered stuck when HARD errors come from
+// `I2CIP_RECOVERY_MODULES` different modules with no success in between (one module failing alone is just that module), or when SDA reads low while idle.
+// Recovery releases the controller, clocks SCL up to nine times until the slave lets go of SDA, issues a STOP, and re-begins the wire.
+
+#define I2CIP_WIRES_USE_RECOVERY true // comment out to disable stuck-bus recovery (modules are torn down on HARD failure)
+#define I2CIP_RECOVERY_MODULES  2     // Distinct failing modules (since the last success) that mark a wire stuck
+#define I2CIP_RECOVERY_HOLDOFF  500   // ms between recovery attempts on the same wire
+#define I2CIP_RECOVERY_HALFCLK  5     // us; half SCL period while bit-banging (~100kHz)
+#define I2CIP_RECOVERY_STRETCH  1000  // us; max wait for a slave to release SCL
+
+namespace I2CIP {
+
+  typedef struct {
+    uint16_t attempts;  // Recovery sequences run
+    uint16_t recovered; // ...that left both lines high
+  } i2cip_recovery_stats_t;
+
+  #ifdef I2CIP_WIRES_USE_RECOVERY
+  namespace Recovery {
+    /**
+     * Set the GPIOs behind a wire (Default: `SDA`/`SCL` for wire 0; none for others). Without pins, recovery only re-begins the wire.
+     * @param wire Wire number
+     * @param sda SDA GPIO (-1: unknown)
+     * @param scl SCL GPIO (-1: unknown)
+     */
+    void setPins(uint8_t wire, int16_t sda, int16_t scl);
+
+    /**
+     * Feed a transaction result into stuck-bus detection. Any success clears the wire's failure set.
+     * @param fqa FQA of the device or module
+     * @param errlev Result
+     */
+    void report(const i2cip_fqa_t& fqa, i2cip_errorlevel_t errlev);
+
+    /**
+     * @param wire Wire number
+     * @return `true` if HARD errors span `I2CIP_RECOVERY_MODULES` modules, or SDA is held low
+     */
+    bool stuck(uint8_t wire);
+
+    /**
+     * Nine-clock + STOP recovery, then re-begin the wire and reset every MUX on it. Rate-limited by `I2CIP_RECOVERY_HOLDOFF`.
+     * @param wire Wire number
+     * @return `true` if both lines are high afterwards (or no pins are known and the wire re-began)
+     */
+    bool recover(uint8_t wire);
+
+    const i2cip_recovery_stats_t& stats(uint8_t wire);
+  };
+  #endif
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef I2CIP_REGMAP_H_
+#define I2CIP_REGMAP_H_
+
+#include <Arduino.h>
+
+#include "device.h"
+
+// ----------------------------------------
+// REGMAP: Shadowed Device Register Files
+// ----------------------------------------
+// Keeps a shadow copy of a device's (8-bit addressed) register file. Field writes modify the shadow and mark the register dirty;
+// `flush()` writes only dirty registers via `Device::writeRegisters()`, coalescing contiguous runs into auto-increment bursts. A register is read from the
+// device at most once, the first time a field of it is written without a known value, so drivers no longer read-modify-write.
+// Usage, in a Device subclass: `RegisterMap<22> regs = RegisterMap<22>(*this);`
+
+#define I2CIP_REGMAP_SEGMENTS 8 // Dirty runs per `Device::writeRegisters()` batch in `flush()`
+
+namespace I2CIP {
+
+  /**
+   * Register shadow for `COUNT` consecutive 8-bit registers starting at `BASE`.
+   * @tparam COUNT Number of registers
+   * @tparam BASE Address of the first register (Default: `0x00`)
+   */
+  template <uint8_t COUNT, uint8_t BASE = 0x00> class RegisterMap {
+    static_assert(COUNT > 0 && (uint16_t)BASE + COUNT <= 0x100, "RegisterMap must fit in an 8-bit register address space.");
+    private:
+      Device& device;
+      const bool autoincrement;               // Device supports multi-byte auto-increment writes
+
+      uint8_t shadow[COUNT] = { 0 };
+      uint8_t valid[(COUNT + 7) / 8] = { 0 };  // Shadow matches device
+      uint8_t dirty[(COUNT + 7) / 8] = { 0 };  // Shadow ahead of device
+
+      static inline bool test(const uint8_t mask[], uint8_t i) { return mask[i >> 3] & (1 << (i & 7)); }
+      static inline void mark(uint8_t mask[], uint8_t i, bool on) { if(on) { mask[i >> 3] |= (1 << (i & 7)); } else { mask[i >> 3] &= ~(1 << (i & 7)); } }
+
+      /**
+       * Ensure the shadow of register `i` is known; reads it from the device once if not.
+       */
+      i2cip_errorlevel_t load(uint8_t i, bool setbus);
+
+    public:
+      /**
+       * @param device Device owning the register file
+       * @param autoincrement Whether the device auto-increments its register pointer on multi-byte writes (Default: `true`)
+       */
+      RegisterMap(Device& device, bool autoincrement = true) : device(device), autoincrement(autoincrement) { }
+
+      static constexpr bool contains(uint8_t reg) { return reg >= BASE && (uint16_t)reg < (uint16_t)BASE + COUNT; }
+
+      bool isValid(uint8_t reg) const { return contains(reg) && test(this->valid, reg - BASE); }
+      bool isDirty(uint8_t reg) const { return contains(reg) && test(this->dirty, reg - BASE); }
+      bool isDirty(void) const;
+
+      /**
+       * Forget all shadowed values (e.g. after a device reset). Pending writes are discarded.
+       */
+      void invalidate(void);
+
+      /**
+       * Declare a register's value as known without reading it (e.g. datasheet power-on defaults).
+       */
+      void seed(uint8_t reg, uint8_t value);
+
+      /**
+       * Read a register, from the shadow if known.
+       * @param reg Register address
+       * @param value Destination
+       * @param refresh Force a device read (Default: `false`)
+       * @param setbus Should the MUX be set (and reset) if a read is needed? (Default: `true`)
+       */
+      i2cip_errorlevel_t read(uint8_t reg, uint8_t& value, bool refresh = false, bool setbus = true);
+
+      /**
+       * Read a bit field of a register, from the shadow if known.
+       * @param lsb Field LSB position
+       * @param bits Field width
+       */
+      i2cip_errorlevel_t readField(uint8_t reg, uint8_t lsb, uint8_t bits, uint8_t& value, bool refresh = false, bool setbus = true);
+
+      /**
+       * Stage a full-register write (no I/O). Unchanged values are not marked dirty.
+       */
+      i2cip_errorlevel_t write(uint8_t reg, uint8_t value);
+
+      /**
+       * Stage a bit field write. Reads the register first only if its value is unknown.
+       */
+      i2cip_errorlevel_t writeField(uint8_t reg, uint8_t lsb, uint8_t bits, uint8_t value, bool setbus = true);
+
+      /**
+       * Write all dirty registers to the device under one MUX selection; contiguous runs become single bursts when `autoincrement`.
+       * @param setbus Should the MUX be set and reset around the flush? (Default: `true`)
+       * @return First error encountered; registers that failed stay dirty
+       */
+      i2cip_errorlevel_t flush(bool setbus = true);
+  };
+};
+
+#include "regmap.tpp"
+
+#endif
@@ -0,0 +1,140 @@
+#ifndef I2CIP_REGMAP_H_
+#error __FILE__ should only be included AFTER <regmap.h>
+#endif
+
+#ifdef I2CIP_REGMAP_H_
+
+#ifndef I2CIP_REGMAP_T_
+#define I2CIP_REGMAP_T_
+
+#include "debug_i2cip.h"
+
+template <uint8_t COUNT, uint8_t BASE> bool I2CIP::RegisterMap<COUNT, BASE>::isDirty(void) const {
+  for(uint8_t i = 0; i < sizeof(this->dirty); i++) {
+    if(this->dirty[i] != 0) return true;
+  }
+  return false;
+}
+
+template <uint8_t COUNT, uint8_t BASE> void I2CIP::RegisterMap<COUNT, BASE>::invalidate(void) {
+  memset(this->valid, 0, sizeof(this->valid));
+  memset(this->dirty, 0, sizeof(this->dirty));
+}
+
+template <uint8_t COUNT, uint8_t BASE> void I2CIP::RegisterMap<COUNT, BASE>::seed(uint8_t reg, uint8_t value) {
+  if(!contains(reg)) return;
+  uint8_t i = reg - BASE;
+  this->shadow[i] = value;
+  mark(this->valid, i, true);
+  mark(this->dirty, i, false);
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::load(uint8_t i, bool setbus) {
+  if(test(this->valid, i) || test(this->dirty, i)) return I2CIP_ERR_NONE;
+  uint8_t value = 0;
+  i2cip_errorlevel_t errlev = this->device.readRegisterByte((uint8_t)(BASE + i), value, setbus, setbus);
+  I2CIP_ERR_BREAK(errlev);
+  this->shadow[i] = value;
+  mark(this->valid, i, true);
+  return I2CIP_ERR_NONE;
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::read(uint8_t reg, uint8_t& value, bool refresh, bool setbus) {
+  if(!contains(reg)) return I2CIP_ERR_SOFT;
+  uint8_t i = reg - BASE;
+  if(refresh && !test(this->dirty, i)) mark(this->valid, i, false); // Never discard a pending write
+  i2cip_errorlevel_t errlev = this->load(i, setbus);
+  I2CIP_ERR_BREAK(errlev);
+  value = this->shadow[i];
+  return I2CIP_ERR_NONE;
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::readField(uint8_t reg, uint8_t lsb, uint8_t bits, uint8_t& value, bool refresh, bool setbus) {
+  uint8_t temp = 0;
+  i2cip_errorlevel_t errlev = this->read(reg, temp, refresh, setbus);
+  I2CIP_ERR_BREAK(errlev);
+  value = READ_BITS(temp, lsb, bits);
+  return I2CIP_ERR_NONE;
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::write(uint8_t reg, uint8_t value) {
+  if(!contains(reg)) return I2CIP_ERR_SOFT;
+  uint8_t i = reg - BASE;
+  if(test(this->valid, i) && !test(this->dirty, i) && this->shadow[i] == value) return I2CIP_ERR_NONE; // No change
+  this->shadow[i] = value;
+  mark(this->dirty, i, true);
+  return I2CIP_ERR_NONE;
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::writeField(uint8_t reg, uint8_t lsb, uint8_t bits, uint8_t value, bool setbus) {
+  if(!contains(reg)) return I2CIP_ERR_SOFT;
+  uint8_t i = reg - BASE;
+  i2cip_errorlevel_t errlev = this->load(i, setbus);
+  I2CIP_ERR_BREAK(errlev);
+  uint8_t updated = (uint8_t)OVERWRITE_BITS(this->shadow[i], value, lsb, bits);
+  if(updated == this->shadow[i]) return I2CIP_ERR_NONE; // No change
+  this->shadow[i] = updated;
+  mark(this->dirty, i, true);
+  return I2CIP_ERR_NONE;
+}
+
+template <uint8_t COUNT, uint8_t BASE> I2CIP::i2cip_errorlevel_t I2CIP::RegisterMap<COUNT, BASE>::flush(bool setbus) {
+  if(!this->isDirty()) return I2CIP_ERR_NONE;
+
+  i2cip_errorlevel_t errlev = setbus ? MUX::setBus(this->device.getFQA()) : I2CIP_ERR_NONE;
+  I2CIP_ERR_BREAK(errlev);
+
+  // Batch dirty runs into segments; Device::writeRegisters coalesces and splits them to fit the Wire buffer
+  i2cip_segment_t segments[I2CIP_REGMAP_SEGMENTS];
+  uint8_t numsegments = 0;
+
+  for(uint8_t i = 0; i <= COUNT; ) {
+    bool end = (i == COUNT);
+    if(!end && !test(this->dirty, i)) { i++; continue; }
+
+    if(end || numsegments == I2CIP_REGMAP_SEGMENTS) {
+      i2cip_errorlevel_t err = (numsegments == 0) ? I2CIP_ERR_NONE : this->device.writeRegisters(segments, numsegments, this->autoincrement, false, false);
+      if(err == I2CIP_ERR_NONE) {
+        // Batch landed; clean every register it covered
+        for(uint8_t k = 0; k < numsegments; k++) {
+          for(uint8_t j = segments[k].reg - BASE; j < segments[k].reg - BASE + segments[k].len; j++) {
+            mark(this->dirty, j, false);
+            mark(this->valid, j, true);
+          }
+        }
+      } else if(err > errlev) {
+        errlev = err; // Batch stays dirty
+      }
+      numsegments = 0;
+      if(end || errlev == I2CIP_ERR_HARD) break;
+    }
+
+    // Dirty run (a single register if the device can't auto-increment)
+    uint8_t len = 1;
+    if(this->autoincrement) {
+      while(i + len < COUNT && test(this->dirty, i + len)) len++;
+    }
+
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.print(F("-> RegMap Flush 0x"));
+      I2CIP_DEBUG_SERIAL.print(BASE + i, HEX);
+      I2CIP_DEBUG_SERIAL.print(F(" x"));
+      I2CIP_DEBUG_SERIAL.println(len);
+      DEBUG_DELAY();
+    #endif
+
+    segments[numsegments++] = { (uint8_t)(BASE + i), len, &this->shadow[i] };
+    i += len;
+  }
+
+  if(setbus) {
+    i2cip_errorlevel_t err = MUX::resetBus(this->device.getFQA());
+    if(err > errlev) errlev = err;
+  }
+  return errlev;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+#include "sink.h"
+
+#include "debug_i2cip.h"
+
+#ifdef I2CIP_OUTPUT_USE_SINK
+
+using namespace I2CIP;
+
+OutputSink* OutputSink::instance = nullptr;
+
+size_t SinkChannel::write(uint8_t c) {
+  if(this->discarding) {
+    if(c == '\n') this->discarding = false;
+    return 1;
+  }
+
+  while(this->used == this->capacity) {
+    if(!this->lossy) {
+      this->sink.unblock(*this);
+    } else {
+      // This message does not fit; drop it, never one already accepted
+      this->discard();
+      this->discarding = (c != '\n');
+      return 1;
+    }
+  }
+
+  noInterrupts();
+  this->buffer[this->head] = c;
+  this->head = (this->head + 1) % this->capacity;
+  this->used++;
+  if(c == '\n') {
+    this->lines++;
+    this->partial = 0;
+  } else {
+    this->partial++;
+  }
+  interrupts();
+
+  if(this->used > this->highwater) this->highwater = this->used;
+  return 1;
+}
+
+void SinkChannel::discard(void) {
+  noInterrupts();
+  this->head = (this->head + this->capacity - this->partial) % this->capacity;
+  this->used -= this->partial;
+  this->partial = 0;
+  interrupts();
+
+  this->sink.dropped++;
+}
+
+OutputSink::OutputSink(Print& out) : out(out),
+  response(*this, responsebuf, I2CIP_SINK_RESPONSE_SIZE, false),
+  telem(*this, telemetrybuf, I2CIP_SINK_TELEMETRY_SIZE, true) {
+  OutputSink::instance = this;
+}
+
+OutputSink::~OutputSink() {
+  this->flush();
+  if(OutputSink::instance == this) OutputSink::instance = nullptr;
+}
+
+size_t OutputSink::pump(SinkChannel& ch, size_t budget, bool partial) {
+  uint8_t chunk[I2CIP_SINK_CHUNK];
+
+  noInterrupts();
+  uint16_t complete = ch.used - ch.partial;
+  uint16_t tail = ch.tail();
+  size_t len = partial ? ch.used : complete;
+  if(len > (size_t)(ch.capacity - tail)) len = ch.capacity - tail; // Up to the wrap
+  if(len > budget) len = budget;
+  if(len > I2CIP_SINK_CHUNK) len = I2CIP_SINK_CHUNK;
+  bool eol = false;
+  for(size_t i = 0; i < len; i++) {
+    chunk[i] = ch.buffer[tail + i];
+    if(chunk[i] == '\n') {
+      len = i + 1;
+      eol = true;
+      break;
+    }
+  }
+  ch.used -= len;
+  if(len > complete) ch.partial -= (len - complete);
+  if(eol) ch.lines--;
+  interrupts();
+
+  if(len == 0) return 0;
+  this->sending = eol ? nullptr : &ch; // Hold the wire until this message is done
+  this->out.write(chunk, len);
+  this->written += len;
+  return len;
+}
+
+void OutputSink::unblock(SinkChannel& ch) {
+  this->blocked++;
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.println(F("-> Output Sink Full; Blocking"));
+    DEBUG_DELAY();
+  #endif
+
+  // Finish whatever the other channel has part-way out, then make room (blocking writes)
+  while(this->sending != nullptr && this->sending != &ch) {
+    if(this->pump(*this->sending, I2CIP_SINK_CHUNK, false) == 0) break;
+  }
+  this->pump(ch, I2CIP_SINK_CHUNK, true);
+}
+
+size_t OutputSink::drain(size_t budget) {
+  if(budget == 0) {
+    int room = this->out.availableForWrite();
+    if(room <= 0) return 0;
+    budget = (size_t)room;
+  }
+
+  size_t total = 0;
+  while(total < budget) {
+    SinkChannel* ch = this->sending;
+    if(ch == nullptr) {
+      if(this->response.lines > 0) ch = &this->response;
+      else if(this->telem.lines > 0) ch = &this->telem;
+      else break;
+    }
+    size_t n = this->pump(*ch, budget - total, false);
+    if(n == 0) break; // Message part-way out is still being written
+    total += n;
+  }
+  return total;
+}
+
+void OutputSink::flush(void) {
+  while(this->drain(I2CIP_SINK_CHUNK) > 0);
+}
+
+void OutputSink::toJSON(JsonObject obj) const {
+  obj["written"] = this->written;
+  obj["dropped"] = this->dropped;
+  obj["blocked"] = this->blocked;
+  const SinkChannel* channels[2] = { &this->response, &this->telem };
+  const char* keys[2] = { "response", "telemetry" };
+  for(uint8_t i = 0; i < 2; i++) {
+    JsonArray arr = obj[keys[i]].to<JsonArray>();
+    arr.add(channels[i]->getUsed());
+    arr.add(channels[i]->getCapacity());
+    arr.add(channels[i]->getHighWater());
+  }
+}
+
+#endif
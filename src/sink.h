@@ -0,0 +1,127 @@
+#ifndef I2CIP_SINK_H_
+#define I2CIP_SINK_H_
+
+#include <Arduino.h>
+
+#include <ArduinoJson.h>
+
+// ---------------------------------------
+// SINK: Non-Blocking Output Buffering
+// ---------------------------------------
+// Output is written into RAM rings instead of straight to the (slow) serial port, and drained from the loop only as fast as the
+// port's TX buffer has room (`availableForWrite()`), so a full TX buffer never stalls sensor or actuator timing.
+// Two channels, each newline-delimited messages; messages are never interleaved on the wire, and responses go out first:
+// - Responses (command answers): never dropped. If the ring is full, the writer blocks and drains it directly (counted).
+// - Telemetry (heartbeats, frames, reports): lossy. If the ring is full, the message being written is dropped whole (counted);
+//   messages already in the ring are never dropped, so a writer that checks `availableForWrite()` first knows it was accepted.
+// Rings are single-producer, single-consumer: write from one context, and `drain()` from one context (loop, or one background task).
+
+#define I2CIP_OUTPUT_USE_SINK true // comment out to disable output buffering (write to Serial directly)
+
+#ifdef __AVR__
+#define I2CIP_SINK_RESPONSE_SIZE  256 // Bytes; most answers fit without blocking
+#define I2CIP_SINK_TELEMETRY_SIZE 256 // Bytes; also the max telemetry frame size (see `I2CIP_TELEMETRY_BYTES`)
+#else
+#define I2CIP_SINK_RESPONSE_SIZE  512
+#define I2CIP_SINK_TELEMETRY_SIZE 1024
+#endif
+#define I2CIP_SINK_CHUNK 32 // Max bytes per `Print::write()` while draining (stack)
+
+#ifdef I2CIP_OUTPUT_USE_SINK
+namespace I2CIP {
+
+  class OutputSink;
+
+  /**
+   * One ring of an OutputSink; write to it as any `Print&`.
+   */
+  class SinkChannel : public Print {
+    friend class OutputSink;
+    private:
+      OutputSink& sink;
+      uint8_t* const buffer;
+      const uint16_t capacity;
+      const bool lossy;                 // Drop the incoming message on overflow (else block)
+
+      volatile uint16_t head = 0;       // Next byte written here
+      volatile uint16_t used = 0;       // Bytes in the ring
+      volatile uint16_t lines = 0;      // Complete (newline-terminated) messages in the ring
+      volatile uint16_t partial = 0;    // Trailing bytes of the message still being written
+      bool discarding = false;          // Message being written did not fit; skip to its newline
+      uint16_t highwater = 0;
+
+      SinkChannel(OutputSink& sink, uint8_t* buffer, uint16_t capacity, bool lossy) : sink(sink), buffer(buffer), capacity(capacity), lossy(lossy) { }
+
+      uint16_t tail(void) const { return (uint16_t)((this->head + this->capacity - this->used) % this->capacity); }
+      void discard(void);
+
+    public:
+      size_t write(uint8_t c) override;
+      using Print::write;
+      int availableForWrite(void) override { return this->capacity - this->used; }
+
+      uint16_t getUsed(void) const { return this->used; }
+      uint16_t getCapacity(void) const { return this->capacity; }
+      uint16_t getHighWater(void) const { return this->highwater; }
+  };
+
+  class OutputSink {
+    friend class SinkChannel;
+    private:
+      static OutputSink* instance; // Most recently constructed sink (for stats)
+
+      Print& out;
+
+      uint8_t responsebuf[I2CIP_SINK_RESPONSE_SIZE];
+      uint8_t telemetrybuf[I2CIP_SINK_TELEMETRY_SIZE];
+      SinkChannel response;
+      SinkChannel telem;
+
+      SinkChannel* sending = nullptr; // Channel whose message is part-way out on the wire
+
+      uint32_t written = 0;  // Bytes drained
+      uint16_t dropped = 0;  // Telemetry messages dropped
+      uint16_t blocked = 0;  // Times a response writer had to drain the ring itself
+
+      /**
+       * Send up to `budget` bytes of one channel, stopping after a newline.
+       * @param partial Also send bytes of the message still being written (blocking path only)
+       * @return Bytes sent
+       */
+      size_t pump(SinkChannel& ch, size_t budget, bool partial);
+      void unblock(SinkChannel& ch);
+
+    public:
+      OutputSink(Print& out);
+      ~OutputSink();
+
+      Print& responses(void) { return this->response; }
+      SinkChannel& telemetry(void) { return this->telem; }
+
+      /**
+       * Move what fits into the port's TX buffer, responses first, without blocking.
+       * @param budget Max bytes (Default: `out.availableForWrite()`)
+       * @return Bytes sent
+       */
+      size_t drain(size_t budget = 0);
+
+      /**
+       * Send everything that is complete, blocking.
+       */
+      void flush(void);
+
+      uint32_t getWritten(void) const { return this->written; }
+      uint16_t getDropped(void) const { return this->dropped; }
+      uint16_t getBlocked(void) const { return this->blocked; }
+
+      /**
+       * Report counters as `{ "written", "dropped", "blocked", "response": [used, size, highwater], "telemetry": [...] }`.
+       */
+      void toJSON(JsonObject obj) const;
+
+      static OutputSink* getInstance(void) { return instance; }
+  };
+};
+#endif
+
+#endif
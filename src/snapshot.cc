@@ -0,0 +1,102 @@
+#include "snapshot.h"
+
+#if defined(I2CIP_TOPOLOGY_USE_SNAPSHOT) && defined(I2CIP_MODULES_USE_TOPOLOGY)
+
+#if defined(ESP32)
+  #include <Preferences.h>
+#else
+  #include <stdio.h>
+#endif
+
+#include "debug_i2cip.h"
+
+static I2CIP::i2cip_snapshot_header_t _snapshot_header(void) {
+  I2CIP::i2cip_snapshot_header_t header;
+  memset(&header, 0, sizeof(header)); // Padding too; headers are compared with memcmp
+  header.magic = I2CIP_SNAPSHOT_MAGIC;
+  header.version = I2CIP_SNAPSHOT_VERSION;
+  header.size = sizeof(I2CIP::topologies);
+  header.crc = I2CIP::crc16((const uint8_t*)I2CIP::topologies, sizeof(I2CIP::topologies));
+  return header;
+}
+
+// Backend: read/write header + body. Body is read into `body` (not the live cache) so a bad snapshot can't clobber it.
+
+#if defined(ESP32)
+
+// Header and body are separate keys, so neither needs a staging buffer
+static bool _snapshot_read(I2CIP::i2cip_snapshot_header_t& header, uint8_t* body, size_t len) {
+  Preferences prefs;
+  if(!prefs.begin(I2CIP_SNAPSHOT_NAMESPACE, true)) return false;
+  bool r = prefs.getBytes(I2CIP_SNAPSHOT_HEADER_KEY, &header, sizeof(header)) == sizeof(header);
+  r = r && prefs.getBytesLength(I2CIP_SNAPSHOT_KEY) == len && prefs.getBytes(I2CIP_SNAPSHOT_KEY, body, len) == len;
+  prefs.end();
+  return r;
+}
+
+static bool _snapshot_write(const I2CIP::i2cip_snapshot_header_t& header, const uint8_t* body, size_t len) {
+  Preferences prefs;
+  if(!prefs.begin(I2CIP_SNAPSHOT_NAMESPACE, false)) return false;
+  // Body first: a reset in between leaves a stale header, whose CRC then fails
+  bool r = prefs.putBytes(I2CIP_SNAPSHOT_KEY, body, len) == len;
+  r = r && prefs.putBytes(I2CIP_SNAPSHOT_HEADER_KEY, &header, sizeof(header)) == sizeof(header);
+  prefs.end();
+  return r;
+}
+
+#else
+
+static bool _snapshot_read(I2CIP::i2cip_snapshot_header_t& header, uint8_t* body, size_t len) {
+  FILE* f = fopen(I2CIP_SNAPSHOT_FILE, "rb");
+  if(f == nullptr) return false;
+  bool r = fread(&header, sizeof(header), 1, f) == 1 && fread(body, 1, len, f) == len;
+  fclose(f);
+  return r;
+}
+
+static bool _snapshot_write(const I2CIP::i2cip_snapshot_header_t& header, const uint8_t* body, size_t len) {
+  FILE* f = fopen(I2CIP_SNAPSHOT_FILE, "wb");
+  if(f == nullptr) return false;
+  bool r = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(body, 1, len, f) == len;
+  fclose(f);
+  return r;
+}
+
+#endif
+
+bool I2CIP::Snapshot::load(void) {
+  i2cip_snapshot_header_t header;
+  static i2cip_topology_t body[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT]; // Static; too big for the loop stack
+  bool r = _snapshot_read(header, (uint8_t*)body, sizeof(body));
+  r = r && header.magic == I2CIP_SNAPSHOT_MAGIC && header.version == I2CIP_SNAPSHOT_VERSION && header.size == sizeof(body) && header.crc == crc16((const uint8_t*)body, sizeof(body));
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.println(r ? F("-> Topology Snapshot Loaded") : F("-> No Valid Topology Snapshot"));
+    DEBUG_DELAY();
+  #endif
+
+  if(r) memcpy(I2CIP::topologies, body, sizeof(body));
+  return r;
+}
+
+bool I2CIP::Snapshot::save(void) {
+  i2cip_snapshot_header_t header = _snapshot_header();
+
+  // Don't wear flash rewriting an identical snapshot
+  i2cip_snapshot_header_t stored;
+  static i2cip_topology_t body[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT];
+  if(_snapshot_read(stored, (uint8_t*)body, sizeof(body)) && memcmp(&stored, &header, sizeof(header)) == 0) return true;
+
+  bool r = _snapshot_write(header, (const uint8_t*)I2CIP::topologies, sizeof(I2CIP::topologies));
+
+  #ifdef I2CIP_DEBUG_SERIAL
+    DEBUG_DELAY();
+    I2CIP_DEBUG_SERIAL.println(r ? F("-> Topology Snapshot Saved") : F("-> Topology Snapshot Save Failed!"));
+    DEBUG_DELAY();
+  #endif
+
+  return r;
+}
+
+#endif
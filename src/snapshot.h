@@ -0,0 +1,52 @@
+#ifndef I2CIP_SNAPSHOT_H_
+#define I2CIP_SNAPSHOT_H_
+
+#include <Arduino.h>
+
+#include "topology.h"
+
+// ------------------------------------------
+// SNAPSHOT: Topology Persistence Across Boot
+// ------------------------------------------
+// Persists `I2CIP::topologies[][]` to MCU non-volatile storage so that modules can be brought online at power-up before their EEPROMs are read.
+// Opt-in (flash wear): build with `-D I2CIP_TOPOLOGY_USE_SNAPSHOT`. Requires `I2CIP_MODULES_USE_TOPOLOGY` (so never on AVR).
+// Backends:
+// - ESP32: NVS via Preferences (namespace `I2CIP_SNAPSHOT_NAMESPACE`)
+// - Otherwise: a file at `I2CIP_SNAPSHOT_FILE` (e.g. native builds)
+
+#define I2CIP_SNAPSHOT_MAGIC      0x4950 // "IP"
+#define I2CIP_SNAPSHOT_VERSION    2 // 2: topologies keyed [wire][mux]
+#define I2CIP_SNAPSHOT_NAMESPACE  "i2cip"
+#define I2CIP_SNAPSHOT_KEY        "topo"
+#define I2CIP_SNAPSHOT_HEADER_KEY "topoh"
+
+#ifndef I2CIP_SNAPSHOT_FILE
+#define I2CIP_SNAPSHOT_FILE       "i2cip_topology.bin"
+#endif
+
+namespace I2CIP {
+  typedef struct {
+    uint16_t magic;
+    uint8_t version;
+    uint16_t size;  // sizeof(topologies)
+    uint16_t crc;   // CRC of topologies
+  } i2cip_snapshot_header_t;
+
+  namespace Snapshot {
+    #if defined(I2CIP_TOPOLOGY_USE_SNAPSHOT) && defined(I2CIP_MODULES_USE_TOPOLOGY)
+    /**
+     * Load `I2CIP::topologies[][]` from non-volatile storage. Leaves the cache untouched if the snapshot is missing, from another build, or corrupt.
+     * @return `true` if a valid snapshot was loaded
+     */
+    bool load(void);
+
+    /**
+     * Write `I2CIP::topologies[][]` to non-volatile storage. Skipped if the stored snapshot already matches.
+     * @return `true` if the stored snapshot is now current
+     */
+    bool save(void);
+    #endif
+  };
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "stage.h"
+
+#include "debug_i2cip.h"
+
+using namespace I2CIP;
+
+bool OutputStage::contains(const Device* device) const {
+  for(uint8_t i = 0; i < this->count; i++) {
+    if(this->entries[i].device == device) return true;
+  }
+  return false;
+}
+
+bool OutputStage::stage(Device* device, const void* value, const void* args) {
+  if(device == nullptr || device->getOutput() == nullptr || value == nullptr) return false;
+
+  // Replace pending value
+  for(uint8_t i = 0; i < this->count; i++) {
+    if(this->entries[i].device == device) {
+      this->entries[i].value = value;
+      this->entries[i].args = args;
+      return true;
+    }
+  }
+  if(this->count >= I2CIP_STAGE_SIZE) return false;
+
+  const i2cip_stage_entry_t entry = { device, value, args };
+  Runs::insert(this->entries, this->count, entry);
+  return true;
+}
+
+bool OutputStage::unstage(Device* device) {
+  for(uint8_t i = 0; i < this->count; i++) {
+    if(this->entries[i].device != device) continue;
+    for(uint8_t j = i + 1; j < this->count; j++) { this->entries[j - 1] = this->entries[j]; }
+    this->count--;
+    return true;
+  }
+  return false;
+}
+
+// Write one staged output
+struct _stage_commit_t {
+  i2cip_errorlevel_t operator()(i2cip_stage_entry_t& e, i2cip_errorlevel_t /* held */) { return e.device->set(e.value, e.args); }
+};
+
+i2cip_errorlevel_t OutputStage::commit(bool rollback) {
+  this->committed = 0;
+
+  _stage_commit_t write;
+  i2cip_errorlevel_t errlev = Runs::walk(this->entries, this->count, write, true, &this->committed);
+
+  if(errlev != I2CIP_ERR_NONE && rollback) {
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.print(F("-> Stage Commit Failed; Rolling Back to Failsafe\n"));
+      DEBUG_DELAY();
+    #endif
+    this->rollback(); // Keep the original error; rollback failures are already flagged per-device
+  }
+
+  this->count = 0;
+  return errlev;
+}
+
+i2cip_errorlevel_t OutputStage::rollback(void) {
+  i2cip_errorlevel_t worst = I2CIP_ERR_NONE;
+  for(uint8_t i = 0; i < this->count; i++) {
+    i2cip_errorlevel_t e = this->entries[i].device->set(nullptr, nullptr); // `OutputSetter::reset()` -> `resetFailsafe()`
+    if(e > worst) worst = e;
+  }
+  return worst;
+}
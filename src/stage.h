@@ -0,0 +1,95 @@
+#ifndef I2CIP_STAGE_H_
+#define I2CIP_STAGE_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+#include "mux.h"
+#include "device.h"
+
+// ---------------------------------------
+// STAGE: Atomic Multi-Device Output
+// ---------------------------------------
+// Callers queue `set` values for many devices, then `commit()` writes them all at once.
+// The stage is kept sorted by FQA, so devices sharing a wire, MUX and bus are contiguous; each such run is written with its bus held
+// (one MUX select and one MUX reset per run, see `MUX::hold()`), instead of once per device.
+// If any write fails, every staged output is rolled back to its failsafe (`OutputSetter::reset()` -> `resetFailsafe()`), so the set lands all-or-nothing.
+// `Runs::insert()` and `Runs::walk()` are the shared sort and run-split, also used by batched commands (see `batchRouter()`).
+
+#define I2CIP_STAGE_SIZE 16 // Max staged outputs per OutputStage
+
+namespace I2CIP {
+
+  typedef struct {
+    Device* device;
+    const void* value;  // Caller-owned; must outlive `commit()`
+    const void* args;   // Caller-owned; `nullptr`: failsafe args (as `Device::set()`)
+  } i2cip_stage_entry_t;
+
+  // Entries are any struct with a `Device* device` member
+  namespace Runs {
+    /**
+     * Insert `entry` into `entries` (`count` of them, sorted by FQA), keeping them sorted so each (wire, MUX, bus) is one contiguous run.
+     * @param count Incremented; the caller checks capacity
+     */
+    template <typename E> void insert(E* entries, uint8_t& count, const E& entry);
+
+    /**
+     * Visit every entry, one run at a time, with the run's bus held selected (one MUX select and one MUX reset per run, see `MUX::hold()`).
+     * @param visit Functor `i2cip_errorlevel_t (E& entry, i2cip_errorlevel_t held)`; `held` is the result of selecting the run's bus
+     * @param stop Stop at the first error (from a bus selection, a visit or a release); otherwise every entry is visited
+     * @param runs Incremented per run whose bus was selected (Optional)
+     * @return First error if `stop`, else the worst
+     */
+    template <typename E, typename V> i2cip_errorlevel_t walk(E* entries, uint8_t count, V& visit, bool stop = false, uint8_t* runs = nullptr);
+  };
+
+  class OutputStage {
+    private:
+      i2cip_stage_entry_t entries[I2CIP_STAGE_SIZE];
+      uint8_t count = 0;
+
+      uint8_t committed = 0;   // Runs (bus selections) written by the last commit
+
+      /**
+       * Roll every staged output back to its failsafe value.
+       * @return Worst error level of the rollback writes
+       */
+      i2cip_errorlevel_t rollback(void);
+
+    public:
+      OutputStage(void) { }
+
+      /**
+       * Queue a `set` for a device. Re-staging a device replaces its pending value.
+       * @param device Device with an output
+       * @param value Value to set (must not be `nullptr`; stage a failsafe explicitly with `OutputSetter::reset()` instead)
+       * @param args Set arguments (`nullptr`: failsafe args)
+       * @return `false` if the device has no output, the value is `nullptr`, or the stage is full
+       */
+      bool stage(Device* device, const void* value, const void* args = nullptr);
+
+      /**
+       * Drop a device from the stage.
+       * @return `true` if it was staged
+       */
+      bool unstage(Device* device);
+
+      void clear(void) { this->count = 0; }
+      uint8_t size(void) const { return this->count; }
+      bool contains(const Device* device) const;
+
+      /**
+       * Write every staged output, one held bus per (wire, MUX, bus) run, then clear the stage.
+       * @param rollback On failure, reset every staged output (written or not) to its failsafe
+       * @return Worst error level; `I2CIP_ERR_NONE` if every write landed
+       */
+      i2cip_errorlevel_t commit(bool rollback = true);
+
+      uint8_t getCommittedRuns(void) const { return this->committed; }
+  };
+};
+
+#include "stage.tpp"
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef I2CIP_STAGE_H_
+#error __FILE__ should only be included AFTER <stage.h>
+#endif
+
+#ifdef I2CIP_STAGE_H_
+
+#ifndef I2CIP_STAGE_T_
+#define I2CIP_STAGE_T_
+
+#include "debug_i2cip.h"
+
+template <typename E> void I2CIP::Runs::insert(E* entries, uint8_t& count, const E& entry) {
+  // Insertion sort by FQA (wire | module | bus | addr)
+  const i2cip_fqa_t fqa = entry.device->getFQA();
+  uint8_t i = count++;
+  while(i > 0 && entries[i - 1].device->getFQA() > fqa) {
+    entries[i] = entries[i - 1];
+    i--;
+  }
+  entries[i] = entry;
+}
+
+template <typename E, typename V> I2CIP::i2cip_errorlevel_t I2CIP::Runs::walk(E* entries, uint8_t count, V& visit, bool stop, uint8_t* runs) {
+  i2cip_errorlevel_t worst = I2CIP_ERR_NONE, first = I2CIP_ERR_NONE;
+
+  uint8_t i = 0;
+  while(i < count) {
+    const i2cip_fqa_t run = entries[i].device->getFQA();
+    const uint8_t wire = I2CIP_FQA_SEG_I2CBUS(run), m = I2CIP_FQA_SEG_MODULE(run), bus = I2CIP_FQA_SEG_MUXBUS(run);
+
+    #ifdef I2CIP_DEBUG_SERIAL
+      DEBUG_DELAY();
+      I2CIP_DEBUG_SERIAL.print(F("-> Run "));
+      I2CIP_DEBUG_SERIAL.print(fqaToString(run));
+      I2CIP_DEBUG_SERIAL.print('\n');
+      DEBUG_DELAY();
+    #endif
+
+    i2cip_errorlevel_t held = MUX::hold(run);
+    if(held > worst) worst = held;
+    if(held != I2CIP_ERR_NONE && stop) return held; // Nothing held; nothing to release
+    if(held == I2CIP_ERR_NONE && runs != nullptr) (*runs)++;
+
+    for(; i < count; i++) {
+      const i2cip_fqa_t fqa = entries[i].device->getFQA();
+      if(I2CIP_FQA_SEG_I2CBUS(fqa) != wire || I2CIP_FQA_SEG_MODULE(fqa) != m || I2CIP_FQA_SEG_MUXBUS(fqa) != bus) break;
+
+      i2cip_errorlevel_t errlev = visit(entries[i], held);
+      if(errlev > worst) worst = errlev;
+      if(errlev != I2CIP_ERR_NONE && stop) { first = errlev; break; }
+    }
+
+    i2cip_errorlevel_t released = MUX::release(run);
+    if(released > worst) worst = released;
+    if(stop && (first != I2CIP_ERR_NONE || released != I2CIP_ERR_NONE)) return (first != I2CIP_ERR_NONE) ? first : released;
+  }
+  return worst;
+}
+
+#endif
+#endif
@@ -0,0 +1,84 @@
+#include "telemetry.h"
+
+#include <DebugJson.h>
+
+#include "device.h"
+#include "module.h"
+
+using namespace I2CIP;
+
+void TelemetryFrame::begin(uint32_t base) {
+  this->doc.clear();
+  this->doc["type"] = "telemetry";
+  this->doc["timestamp"] = base;
+  this->data = this->doc["data"].to<JsonArray>();
+  this->base = base;
+  this->count = 0;
+  this->full = false;
+  this->bytes = measureJson(this->doc) + 2; // "\r\n"
+}
+
+bool TelemetryFrame::add(Device* device) {
+  if(device == nullptr || this->full || this->count >= I2CIP_TELEMETRY_MAX) return false;
+  InputGetter* input = device->getInput();
+  if(input == nullptr || !input->unreported()) return false;
+
+  JsonObject entry = this->data.add<JsonObject>();
+  entry["f"] = device->getFQA();
+  entry["d"] = (int32_t)(this->base - (uint32_t)input->getLastRX());
+  #ifdef I2CIP_INPUTS_USE_TOSTRING
+    entry["v"] = input->cacheToString();
+  #endif
+  #ifdef I2CIP_DEVICES_USE_LATENCY
+    entry["j"] = device->getJitter().getJitter();
+  #endif
+
+  size_t n = measureJson(entry) + (this->count > 0 ? 1 : 0); // ","
+  if(this->bytes + n > I2CIP_TELEMETRY_BYTES) {
+    // Carry over to the next frame
+    this->data.remove(this->count);
+    this->full = true;
+    return false;
+  }
+  this->bytes += n;
+
+  this->pending[this->count] = input;
+  this->versions[this->count] = input->getVersion();
+  this->count++;
+  return true;
+}
+
+uint8_t TelemetryFrame::collect(void) {
+  uint8_t added = 0;
+  uint16_t size = I2CIP::devicetree.size();
+  for(uint16_t i = 0; i < size && !this->full && this->count < I2CIP_TELEMETRY_MAX; i++) {
+    Device** d = I2CIP::devicetree.getByIndex(i);
+    if(d != nullptr && this->add(*d)) added++;
+  }
+  return added;
+}
+
+bool TelemetryFrame::accept(void) {
+  for(uint8_t i = 0; i < this->count; i++) this->pending[i]->markReported(this->versions[i]);
+  return (this->count > 0);
+}
+
+bool TelemetryFrame::send(Print& out) {
+  if(this->count > 0) DebugJson::jsonPrintln(this->doc, out); // Blocking writer; always accepted
+  bool sent = this->accept();
+  this->begin();
+  return sent;
+}
+
+#ifdef I2CIP_OUTPUT_USE_SINK
+bool TelemetryFrame::send(SinkChannel& out) {
+  bool sent = false;
+  if(this->count > 0 && (size_t)out.availableForWrite() >= this->bytes) {
+    // Single producer: the room checked here is still there, and the lossy ring never drops what it has accepted
+    DebugJson::jsonPrintln(this->doc, out);
+    sent = this->accept();
+  }
+  this->begin();
+  return sent;
+}
+#endif
@@ -0,0 +1,85 @@
+#ifndef I2CIP_TELEMETRY_H_
+#define I2CIP_TELEMETRY_H_
+
+#include <Arduino.h>
+
+#include <ArduinoJson.h>
+
+#include "fqa.h"
+#include "sink.h"
+
+// ---------------------------------------
+// TELEMETRY: Per-Cycle Aggregated Frames
+// ---------------------------------------
+// Instead of one framed, timestamped message per device read, a TelemetryFrame collects every input whose cache changed
+// since it was last reported (see `InputGetter::unreported()`) and emits them together, once per cycle:
+// `{"type":"telemetry","timestamp":BASE,"data":[{"f":FQA,"d":AGE,"v":CACHE,"j":JITTER}, ...]}`, where AGE = BASE - lastrx (ms)
+// and JITTER is the read-interval jitter in us (with `I2CIP_DEVICES_USE_LATENCY`).
+// Nothing is written if nothing changed. Entries are marked reported only once the frame is accepted by the output; a frame the
+// telemetry ring has no room for is held back, and its inputs are collected again (with their latest cache) next cycle.
+
+#ifdef __AVR__
+#define I2CIP_TELEMETRY_MAX 8   // Max entries per frame; the rest carry over to the next frame
+#else
+#define I2CIP_TELEMETRY_MAX 64
+#endif
+#define I2CIP_TELEMETRY_BYTES I2CIP_SINK_TELEMETRY_SIZE // Max serialized frame size, so a frame always fits the empty telemetry ring
+
+namespace I2CIP {
+  class Device;
+  class InputGetter;
+
+  class TelemetryFrame {
+    private:
+      JsonDocument doc;
+      JsonArray data;
+      uint32_t base = 0;
+      uint8_t count = 0;
+      size_t bytes = 0;   // Serialized size, with line ending
+      bool full = false;  // An entry did not fit in `I2CIP_TELEMETRY_BYTES`
+
+      InputGetter* pending[I2CIP_TELEMETRY_MAX]; // Entries to mark reported once the frame is accepted
+      uint16_t versions[I2CIP_TELEMETRY_MAX];
+
+      bool accept(void);
+
+    public:
+      TelemetryFrame(void) { this->begin(); }
+
+      /**
+       * Start a new (empty) frame.
+       * @param base Frame base time; entry ages are relative to it (Default: now)
+       */
+      void begin(uint32_t base = millis());
+
+      /**
+       * Add a device if its input changed since it was last reported, and the frame has room for it.
+       * @return `true` if added
+       */
+      bool add(Device* device);
+
+      /**
+       * Add every changed input in the device tree.
+       * @return Number of entries added
+       */
+      uint8_t collect(void);
+
+      uint8_t size(void) const { return this->count; }
+
+      /**
+       * Write the frame (one message, one write) if it has any entries, mark them reported, then start a new one.
+       * @return `true` if anything was written
+       */
+      bool send(Print& out);
+
+      #ifdef I2CIP_OUTPUT_USE_SINK
+        /**
+         * As `send(Print&)`, but only if the ring has room for the whole frame; otherwise the entries stay unreported.
+         * @return `true` if the frame was accepted
+         */
+        bool send(SinkChannel& out);
+      #endif
+  };
+};
+
+#endif
@@ -0,0 +1,50 @@
+#include "topology.h"
+
+using namespace I2CIP;
+
+// Globals
+#ifdef I2CIP_MODULES_USE_TOPOLOGY
+i2cip_topology_t I2CIP::topologies[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT];
+#endif
+
+uint16_t I2CIP::crc16(const uint8_t* data, size_t len, uint16_t crc) {
+  for(size_t i = 0; i < len; i++) {
+    crc ^= ((uint16_t)data[i] << 8);
+    for(uint8_t b = 0; b < 8; b++) {
+      crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+void Topology::clear(i2cip_topology_t& topo) {
+  topo.wire = I2CIP_TOPOLOGY_INVALID;
+  topo.len = 0;
+  topo.crc = 0;
+  topo.numgroups = 0;
+  topo.numdevices = 0;
+}
+
+bool Topology::valid(const i2cip_topology_t& topo, uint8_t wire) {
+  return topo.wire == wire && topo.len > 0 && topo.numgroups <= I2CIP_TOPOLOGY_GROUPS && topo.numdevices <= I2CIP_TOPOLOGY_DEVICES;
+}
+
+uint8_t Topology::addGroup(i2cip_topology_t& topo, const char* id) {
+  if(id == nullptr || id[0] == '\0') return I2CIP_TOPOLOGY_INVALID;
+  for(uint8_t g = 0; g < topo.numgroups; g++) {
+    if(strncmp(topo.ids[g], id, I2CIP_ID_SIZE) == 0) return g;
+  }
+  if(topo.numgroups >= I2CIP_TOPOLOGY_GROUPS || strlen(id) >= I2CIP_ID_SIZE) return I2CIP_TOPOLOGY_INVALID;
+  strncpy(topo.ids[topo.numgroups], id, I2CIP_ID_SIZE);
+  return topo.numgroups++;
+}
+
+bool Topology::addDevice(i2cip_topology_t& topo, const i2cip_fqa_t& fqa, const char* id) {
+  if(topo.numdevices >= I2CIP_TOPOLOGY_DEVICES) return false;
+  uint8_t g = addGroup(topo, id);
+  if(g == I2CIP_TOPOLOGY_INVALID) return false;
+  topo.devices[topo.numdevices].fqa = fqa;
+  topo.devices[topo.numdevices].group = g;
+  topo.numdevices++;
+  return true;
+}
@@ -0,0 +1,86 @@
+#ifndef I2CIP_TOPOLOGY_H_
+#define I2CIP_TOPOLOGY_H_
+
+#include <Arduino.h>
+
+#include "fqa.h"
+#include "mux.h"
+
+// ----------------------------------
+// TOPOLOGY: Cached Module Contents
+// ----------------------------------
+// A compact descriptor of the devices a module's EEPROM declared, keyed by a CRC of the EEPROM contents.
+// The CRC is also stamped into the EEPROM just past the content's null terminator: | CONTENTS (len) | '\0' | MAGIC | CRC HI | CRC LO |
+// On reattach, the trailer and a CRC over the raw contents confirm they are unchanged, and the devices are restored from the descriptor without a parse.
+// Descriptors are indexed by wire and module.
+
+#ifndef __AVR__
+#define I2CIP_MODULES_USE_TOPOLOGY true // comment out to disable topology caching (always rediscover from EEPROM)
+#endif
+
+#define I2CIP_TOPOLOGY_GROUPS   8     // Max distinct DeviceGroup IDs per module
+#define I2CIP_TOPOLOGY_DEVICES  16    // Max devices per module (excluding the module's own EEPROM)
+#define I2CIP_TOPOLOGY_MAGIC    0xC5  // Trailer marker byte
+#define I2CIP_TOPOLOGY_TRAILER  4     // Trailer length, including the content null terminator
+#define I2CIP_TOPOLOGY_INVALID  0xFF  // `wire` value of an empty descriptor
+
+#ifndef I2CIP_ID_SIZE
+#define I2CIP_ID_SIZE ((size_t)10)
+#endif
+
+namespace I2CIP {
+
+  /**
+   * CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF).
+   * @param data Bytes to checksum
+   * @param len Number of bytes
+   * @param crc Running CRC (Default: init value; pass the last result to continue)
+   * @return Updated CRC
+   */
+  uint16_t crc16(const uint8_t* data, size_t len, uint16_t crc = 0xFFFF);
+
+  typedef struct {
+    i2cip_fqa_t fqa;
+    uint8_t group; // Index into `ids`
+  } i2cip_topology_device_t;
+
+  typedef struct {
+    uint8_t wire;       // Wire the module was found on; `I2CIP_TOPOLOGY_INVALID` if empty
+    uint16_t len;       // EEPROM content length (excluding null terminator)
+    uint16_t crc;       // CRC of the EEPROM contents
+    uint8_t numgroups;
+    char ids[I2CIP_TOPOLOGY_GROUPS][I2CIP_ID_SIZE]; // DeviceGroup IDs, null-terminated
+    uint8_t numdevices;
+    i2cip_topology_device_t devices[I2CIP_TOPOLOGY_DEVICES];
+  } i2cip_topology_t;
+
+  #ifdef I2CIP_MODULES_USE_TOPOLOGY
+  extern i2cip_topology_t topologies[I2CIP_NUM_WIRES][I2CIP_MUX_COUNT]; // Indexed by wire and module number; outlives Module objects
+  #endif
+
+  namespace Topology {
+    /**
+     * Empty a descriptor.
+     */
+    void clear(i2cip_topology_t& topo);
+
+    /**
+     * @return `true` if the descriptor holds a module on the given wire
+     */
+    bool valid(const i2cip_topology_t& topo, uint8_t wire);
+
+    /**
+     * Find or append a group ID.
+     * @return Index into `topo.ids`, or `I2CIP_TOPOLOGY_INVALID` if full
+     */
+    uint8_t addGroup(i2cip_topology_t& topo, const char* id);
+
+    /**
+     * Append a device under a group ID.
+     * @return `false` if the descriptor is full
+     */
+    bool addDevice(i2cip_topology_t& topo, const i2cip_fqa_t& fqa, const char* id);
+  };
+};
+
+#endif
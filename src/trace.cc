@@ -0,0 +1,81 @@
+#include "trace.h"
+
+#ifdef I2CIP_USE_TRACE
+
+#include "jsonstream.h"
+
+using namespace I2CIP;
+
+static i2cip_trace_t _ring[I2CIP_TRACE_SIZE];
+static volatile uint16_t _head = 0;   // Next write
+static volatile uint16_t _count = 0;
+static volatile uint32_t _lost = 0;
+static volatile bool _enabled = true;
+
+void Trace::record(uint8_t event, uint16_t fqa, uint8_t arg) {
+  if(!_enabled) return;
+  uint32_t now = micros();
+
+  noInterrupts();
+  i2cip_trace_t& e = _ring[_head];
+  e.time = now;
+  e.fqa = fqa;
+  e.event = event;
+  e.arg = arg;
+  _head = (_head + 1) % I2CIP_TRACE_SIZE;
+  if(_count < I2CIP_TRACE_SIZE) _count++;
+  else _lost++;
+  interrupts();
+}
+
+void Trace::enable(bool enabled) { _enabled = enabled; }
+bool Trace::enabled(void) { return _enabled; }
+
+uint16_t Trace::size(void) { return _count; }
+uint32_t Trace::lost(void) { return _lost; }
+
+void Trace::clear(void) {
+  noInterrupts();
+  _head = 0;
+  _count = 0;
+  _lost = 0;
+  interrupts();
+}
+
+bool Trace::at(uint16_t i, i2cip_trace_t& dest) {
+  noInterrupts();
+  bool r = (i < _count);
+  if(r) dest = _ring[(_head + I2CIP_TRACE_SIZE - _count + i) % I2CIP_TRACE_SIZE];
+  interrupts();
+  return r;
+}
+
+void Trace::dump(Print& out) {
+  // Freeze while printing so the dump is one consistent window
+  bool was = _enabled;
+  _enabled = false;
+
+  JsonStream json(out);
+  json.beginObject();
+  json.member("type", "trace");
+  json.member("timestamp", millis());
+  json.member("lost", (unsigned long)_lost);
+  json.key("data").beginArray();
+  i2cip_trace_t e;
+  for(uint16_t i = 0; Trace::at(i, e); i++) {
+    json.beginArray();
+    json.value((unsigned long)e.time);
+    json.value(e.event);
+    json.value(e.fqa);
+    json.value(e.arg);
+    json.endArray();
+  }
+  json.endArray();
+  json.endObject();
+  json.end();
+
+  Trace::clear();
+  _enabled = was;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef I2CIP_TRACE_H_
+#define I2CIP_TRACE_H_
+
+#include <Arduino.h>
+
+// ---------------------------------------
+// TRACE: Deferred-Format Binary Event Log
+// ---------------------------------------
+// `I2CIP_DEBUG_SERIAL` text output costs milliseconds per call and changes the timing it is meant to observe.
+// `I2CIP_TRACE(event, fqa, arg)` instead stores 8 bytes (micros, FQA, event, arg) in a RAM ring - a few microseconds, no I/O.
+// The ring keeps the most recent events (older ones are overwritten and counted); it is only formatted when asked for:
+// `{"trace":true}` dumps it as `{"type":"trace","timestamp","lost","data":[[us, event, fqa, arg], ...]}` (host/i2cip_trace.py names the events).
+// Trace and text debug are independent; enable either or both.
+
+// #define I2CIP_USE_TRACE true // uncomment to record trace events
+
+#ifdef __AVR__
+#define I2CIP_TRACE_SIZE 32  // Events (8 bytes each)
+#else
+#define I2CIP_TRACE_SIZE 256
+#endif
+
+typedef enum {
+  I2CIP_TRACE_NONE = 0x00,
+
+  // Device                          ARG
+  I2CIP_TRACE_DEVICE_GET      = 0x01, // -
+  I2CIP_TRACE_DEVICE_SET      = 0x02, // -
+  I2CIP_TRACE_DEVICE_SETTLE   = 0x03, // errlev (end of GET/SET)
+  I2CIP_TRACE_DEVICE_PING     = 0x04, // errlev
+
+  // MUX (FQA device address 0)
+  I2CIP_TRACE_MUX_SET         = 0x10, // instruction
+  I2CIP_TRACE_MUX_RESET       = 0x11, // -
+  I2CIP_TRACE_MUX_FAIL        = 0x12, // errlev
+
+  // Containers
+  I2CIP_TRACE_BST_INSERT      = 0x20, // -  (FQA: key)
+  I2CIP_TRACE_BST_REMOVE      = 0x21, // -  (FQA: key)
+  I2CIP_TRACE_HASHTABLE_SET   = 0x22, // slot
+  I2CIP_TRACE_HASHTABLE_REMOVE = 0x23, // slot
+
+  // Module
+  I2CIP_TRACE_MODULE_DISCOVER = 0x30, // recurse (FQA: EEPROM)
+  I2CIP_TRACE_RECOVERY        = 0x31, // recovered (FQA: wire only)
+
+  I2CIP_TRACE_USER            = 0x80, // Application events from here
+} i2cip_trace_event_t;
+
+typedef struct {
+  uint32_t time;    // micros()
+  uint16_t fqa;
+  uint8_t event;
+  uint8_t arg;
+} i2cip_trace_t;
+
+#ifdef I2CIP_USE_TRACE
+#define I2CIP_TRACE(event, fqa, arg) I2CIP::Trace::record((uint8_t)(event), (uint16_t)(fqa), (uint8_t)(arg))
+#else
+#define I2CIP_TRACE(event, fqa, arg)
+#endif
+
+// Trace FQA field for container keys; non-integral keys are not recorded
+inline uint16_t i2cip_trace_key(uint16_t key) { return key; }
+template <typename K> inline uint16_t i2cip_trace_key(const K&) { return 0; }
+
+#ifdef I2CIP_USE_TRACE
+namespace I2CIP {
+  namespace Trace {
+    /**
+     * Record one event (overwrites the oldest if full). Safe from ISRs.
+     */
+    void record(uint8_t event, uint16_t fqa, uint8_t arg);
+
+    /**
+     * Stop or resume recording, i.e. to freeze the history leading up to a fault.
+     */
+    void enable(bool enabled);
+    bool enabled(void);
+
+    uint16_t size(void);
+    uint32_t lost(void); // Events overwritten since the last clear
+    void clear(void);
+
+    /**
+     * Copy an event out, oldest first.
+     * @return `false` if `i` is past the end
+     */
+    bool at(uint16_t i, i2cip_trace_t& dest);
+
+    /**
+     * Stream every event as JSON (constant memory; see file header), then clear.
+     */
+    void dump(Print& out);
+  };
+};
+#endif
+
+#endif
@@ -76,7 +76,9 @@ class TestModule : public JsonModule {
         DeviceGroup* dg = this->operator[](d->getID());
 
         if(dg != nullptr && dg->handler != nullptr) {
+          StaticArena<I2CIP_ARGS_ARENA_SIZE> arena; // Argument objects for this command only
           i2cip_args_io_t args = _i2cip_args_io_default;
+          args.arena = &arena;
     
           JsonVariant argsG = command["g"];
           JsonVariant argsA = command["a"];
@@ -109,10 +111,7 @@ class TestModule : public JsonModule {
               else spacer = true;
               msg += "INPGET ";
               msg += d->getInput()->printCache();
-
-              if(errlev == I2CIP_ERR_NONE) {
-                DebugJson::telemetryJsonString(d->getInput()->getLastRX(), d->getInput()->cacheToString());
-              }
+              // Changed caches are reported once per cycle, aggregated (see TelemetryFrame)
             }
             if(errlev == I2CIP_ERR_NONE && argsG.isNull() && argsS.isNull()) {
               errlev = d->pingTimeout(false, true);
@@ -175,6 +174,7 @@ class TestModule : public JsonModule {
 #define PEAPOD_PIN_OUT 32 // Multipurpose; Direct input from rotary button
 #define PEAPOD_PIN_PWM1 15 // Multipurpose; Interpreted output from rotary knob (0-360 -> 0-255)
 #define PEAPOD_PIN_PWM2 14 // Multipurpose; Interpreted output from rotary knob (0-360 -> 0-255)
+#define PEAPOD_PIN_INT 27 // MCP23017 INTA (open-drain, active-low; wired-OR across modules)
 
 #define DURATION_WATERING   2000     // 10 seconds every...
 #define PERIOD_WATERING     10000   //  ...30 minutes
@@ -200,6 +200,19 @@ bool flag_debounce = false; // Used to debounce for toggles
 
 HT16K33 *ht16k33 = nullptr;
 
+#ifdef I2CIP_INPUTS_USE_INTERRUPTS
+// Bind a module's MCP23017 inputs to the shared INT line; once bound, they are only polled on an edge (or their safety poll)
+void bindInterrupts(Module& module) {
+  DeviceGroup* dg = module.find(MCP23017::getID());
+  if(dg == nullptr) return;
+  for(uint8_t i = 0; i < dg->getNumDevices(); i++) {
+    Device* d = dg->getDevice(i);
+    if(d == nullptr || d->getInput() == nullptr || d->getInput()->isBound()) continue;
+    d->getInput()->bindInterrupt(PEAPOD_PIN_INT);
+  }
+}
+#endif
+
 bool pinModeSet[255] = { false };
 
 template <unsigned char P> void controlPin(const bool& s) {
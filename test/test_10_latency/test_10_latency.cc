@@ -0,0 +1,63 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <latency.h>
+
+using namespace I2CIP;
+
+LatencyHistogram histogram;
+JitterTracker jitter;
+
+void test_latency_buckets(void) {
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, LatencyHistogram::bucket(0), "Latency Bucket: 0us");
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, LatencyHistogram::bucket(1), "Latency Bucket: 1us");
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(1, LatencyHistogram::bucket(3), "Latency Bucket: 3us");
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(10, LatencyHistogram::bucket(1024), "Latency Bucket: 1024us");
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(I2CIP_LATENCY_BUCKETS - 1, LatencyHistogram::bucket(UINT32_MAX), "Latency Bucket: Open-ended");
+}
+
+void test_latency_percentile(void) {
+  for(uint8_t i = 0; i < 99; i++) histogram.record(100);  // Bucket 6: [64, 128)
+  histogram.record(5000);                                  // Bucket 12: [4096, 8192)
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(100, histogram.getCount(), "Latency Percentile: Count");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(100, histogram.getMin(), "Latency Percentile: Min");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(5000, histogram.getMax(), "Latency Percentile: Max");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(127, histogram.percentile(50), "Latency Percentile: p50 bucket top");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(5000, histogram.percentile(100), "Latency Percentile: p100 clamped to max");
+}
+
+void test_latency_jitter(void) {
+  // Perfectly periodic: no jitter
+  for(uint32_t t = 0; t <= 10000; t += 1000) jitter.sample(t);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, jitter.getJitter(), "Latency Jitter: Periodic");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(1000, jitter.getInterval(), "Latency Jitter: Interval");
+
+  // One late sample (+1600us) moves the estimate by 1/16 of the deviation
+  jitter.sample(12600);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(100, jitter.getJitter(), "Latency Jitter: Late sample");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(2600, jitter.getMaxInterval(), "Latency Jitter: Max interval");
+}
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_latency_buckets);
+
+  delay(1000);
+
+  RUN_TEST(test_latency_percentile);
+
+  delay(1000);
+
+  RUN_TEST(test_latency_jitter);
+
+  delay(1000);
+
+  UNITY_END();
+}
+
+void loop() {
+
+}
@@ -0,0 +1,65 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <binary.h>
+
+using namespace I2CIP;
+
+#define TEST_BINARY_LONG 300 // Longer than one COBS block (254 non-zero bytes)
+
+uint8_t encoded[TEST_BINARY_LONG + TEST_BINARY_LONG / 254 + 1];
+uint8_t decoded[TEST_BINARY_LONG];
+
+void test_binary_cobs_zeros(void) {
+  const uint8_t frame[] = { 0x00, 0x11, 0x00, 0x00, 0x22, 0x33, 0x00 };
+  size_t n = Binary::cobsEncode(frame, sizeof(frame), encoded);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(sizeof(frame) + 1, n, "COBS Encode: Length");
+  for(size_t i = 0; i < n; i++) {
+    TEST_ASSERT_NOT_EQUAL_MESSAGE(0x00, encoded[i], "COBS Encode: Delimiter in frame");
+  }
+
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(sizeof(frame), Binary::cobsDecode(encoded, n), "COBS Decode: Length");
+  TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(frame, encoded, sizeof(frame), "COBS Decode: Round trip");
+}
+
+void test_binary_cobs_long(void) {
+  for(size_t i = 0; i < TEST_BINARY_LONG; i++) decoded[i] = (uint8_t)(i % 255) + 1; // No zeros; forces 0xFF blocks
+  size_t n = Binary::cobsEncode(decoded, TEST_BINARY_LONG, encoded);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(TEST_BINARY_LONG + 2, n, "COBS Encode: Block overhead");
+  TEST_ASSERT_EQUAL_HEX8_MESSAGE(0xFF, encoded[0], "COBS Encode: Full block code");
+
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(TEST_BINARY_LONG, Binary::cobsDecode(encoded, n), "COBS Decode: Length");
+  TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(decoded, encoded, TEST_BINARY_LONG, "COBS Decode: Round trip");
+}
+
+void test_binary_cobs_malformed(void) {
+  uint8_t overrun[] = { 0x05, 0x11, 0x22 }; // Code runs past the end
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, Binary::cobsDecode(overrun, sizeof(overrun)), "COBS Decode: Overrun accepted");
+
+  uint8_t delimiter[] = { 0x02, 0x11, 0x00, 0x22 }; // Delimiter inside the frame
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, Binary::cobsDecode(delimiter, sizeof(delimiter)), "COBS Decode: Delimiter accepted");
+}
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_binary_cobs_zeros);
+
+  delay(1000);
+
+  RUN_TEST(test_binary_cobs_long);
+
+  delay(1000);
+
+  RUN_TEST(test_binary_cobs_malformed);
+
+  delay(1000);
+
+  UNITY_END();
+}
+
+void loop() {
+
+}
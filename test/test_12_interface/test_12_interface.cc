@@ -0,0 +1,73 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <I2CIP.hpp>
+
+using namespace I2CIP;
+
+// Device-less input: reads `next`; the failsafe default is 0
+class TestInput : public InputInterface<uint8_t, uint8_t> {
+  I2CIP_INPUT_USE_TOSTRING(uint8_t, "%u");
+  private:
+    const uint8_t defaultA = 0;
+  public:
+    uint8_t next = 42;
+    TestInput(void) : InputInterface<uint8_t, uint8_t>(nullptr) { }
+    using InputInterface<uint8_t, uint8_t>::get;
+    i2cip_errorlevel_t get(uint8_t& dest, const uint8_t& args) override { dest = this->next; return I2CIP_ERR_NONE; }
+    void clearCache(void) override { this->setCache(0); }
+    const uint8_t& getDefaultA(void) const override { return this->defaultA; }
+};
+
+TestInput input;
+
+void test_interface_first_read(void) {
+  uint16_t version = input.getVersion();
+  TEST_ASSERT_EQUAL_INT_MESSAGE(I2CIP_ERR_NONE, input.failGet(), "Interface Read: Failed");
+  TEST_ASSERT_EQUAL_UINT8_MESSAGE(42, input.getCache(), "Interface Read: Value match");
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(version + 1, input.getVersion(), "Interface Read: Change not counted once");
+  TEST_ASSERT_EQUAL_STRING_MESSAGE("42", input.cacheToString(), "Interface Read: String match");
+}
+
+void test_interface_unchanged_read(void) {
+  uint16_t version = input.getVersion();
+  const char* rendered = input.cacheToString();
+  TEST_ASSERT_EQUAL_INT_MESSAGE(I2CIP_ERR_NONE, input.failGet(), "Interface Reread: Failed");         // Failsafe path (clears first)
+  TEST_ASSERT_EQUAL_INT_MESSAGE(I2CIP_ERR_NONE, input.get(nullptr), "Interface Reread: Failed");      // Last-args path
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(version, input.getVersion(), "Interface Reread: Same value counted as a change");
+  TEST_ASSERT_FALSE_MESSAGE(input.unreported(), "Interface Reread: Same value unreported");
+  TEST_ASSERT_EQUAL_PTR_MESSAGE(rendered, input.cacheToString(), "Interface Reread: String not memoized");
+}
+
+void test_interface_changed_read(void) {
+  uint16_t version = input.getVersion();
+  input.next = 7;
+  TEST_ASSERT_EQUAL_INT_MESSAGE(I2CIP_ERR_NONE, input.failGet(), "Interface Change: Failed");
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(version + 1, input.getVersion(), "Interface Change: Not counted once");
+  TEST_ASSERT_EQUAL_STRING_MESSAGE("7", input.cacheToString(), "Interface Change: Stale string");
+}
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_interface_first_read);
+
+  delay(1000);
+
+  input.markReported(input.getVersion());
+  RUN_TEST(test_interface_unchanged_read);
+
+  delay(1000);
+
+  RUN_TEST(test_interface_changed_read);
+
+  delay(1000);
+
+  UNITY_END();
+}
+
+void loop() {
+
+}
@@ -0,0 +1,69 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#define I2CIP_DEVICES_USE_POOLS true
+
+#include <pool.h>
+
+using namespace I2CIP;
+
+class Pooled {
+  I2CIP_DEVICE_USE_POOL(Pooled, 2);
+  public:
+    Pooled(uint32_t value) : value(value) { }
+    virtual ~Pooled() { }
+    uint32_t value;
+};
+
+Pooled* a = nullptr;
+Pooled* b = nullptr;
+Pooled* c = nullptr;
+
+void test_pool_allocate(void) {
+  a = new Pooled(1);
+  b = new Pooled(2);
+  TEST_ASSERT_TRUE_MESSAGE(a != nullptr && b != nullptr, "Pool Allocate: nullptr");
+  TEST_ASSERT_TRUE_MESSAGE(a != b, "Pool Allocate: Same Slot Twice");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, a->value, "Pool Allocate: Value match");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(2, b->value, "Pool Allocate: Value match");
+}
+
+void test_pool_overflow(void) {
+  c = new Pooled(3); // Third object; pool of two overflows to heap
+  TEST_ASSERT_TRUE_MESSAGE(c != nullptr, "Pool Overflow: nullptr");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(3, c->value, "Pool Overflow: Value match");
+  delete c;
+}
+
+void test_pool_reuse(void) {
+  Pooled* old = b;
+  delete b;
+  b = new Pooled(4);
+  TEST_ASSERT_EQUAL_PTR_MESSAGE(old, b, "Pool Reuse: Freed slot not reused");
+  delete a;
+  delete b;
+}
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_pool_allocate);
+
+  delay(1000);
+
+  RUN_TEST(test_pool_overflow);
+
+  delay(1000);
+
+  RUN_TEST(test_pool_reuse);
+
+  delay(1000);
+
+  UNITY_END();
+}
+
+void loop() {
+
+}
@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <device.h>
+
+using namespace I2CIP;
+
+StaticArena<16> arena;
+i2cip_args_io_t args = _i2cip_args_io_default;
+
+void test_arena_allocate(void) {
+  args.arena = &arena;
+  args.a = I2CIP_ARGS_NEW(args, uint16_t, 0xBEEF);
+  args.b = I2CIP_ARGS_NEW(args, uint32_t, 0xDEADBEEF);
+  TEST_ASSERT_TRUE_MESSAGE(arena.owns(args.a) && arena.owns(args.b), "Arena Allocate: Not in arena");
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(0xBEEF, *(uint16_t*)args.a, "Arena Allocate: Value match");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0xDEADBEEF, *(uint32_t*)args.b, "Arena Allocate: Value match");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, ((uintptr_t)args.b) % alignof(uint32_t), "Arena Allocate: Misaligned");
+}
+
+void test_arena_overflow(void) {
+  args.s = I2CIP_ARGS_NEW_ARRAY(args, char, 32); // Larger than what's left; falls back to the heap
+  TEST_ASSERT_TRUE_MESSAGE(args.s != nullptr, "Arena Overflow: nullptr");
+  TEST_ASSERT_FALSE_MESSAGE(arena.owns(args.s), "Arena Overflow: Should be heap");
+  TEST_ASSERT_EQUAL_UINT16_MESSAGE(1, arena.getOverflows(), "Arena Overflow: Not counted");
+  I2CIP_ARGS_DELETE_ARRAY(args, char, args.s);
+}
+
+void test_arena_reset(void) {
+  void* first = args.a;
+  I2CIP_ARGS_DELETE(args, uint16_t, args.a);
+  I2CIP_ARGS_DELETE(args, uint32_t, args.b);
+  TEST_ASSERT_NULL_MESSAGE(args.a, "Arena Delete: Pointer not cleared");
+  arena.reset();
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, arena.getUsed(), "Arena Reset: Still in use");
+  args.a = I2CIP_ARGS_NEW(args, uint16_t, 1);
+  TEST_ASSERT_EQUAL_PTR_MESSAGE(first, args.a, "Arena Reset: Storage not reused");
+}
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_arena_allocate);
+
+  delay(1000);
+
+  RUN_TEST(test_arena_overflow);
+
+  delay(1000);
+
+  RUN_TEST(test_arena_reset);
+
+  delay(1000);
+
+  UNITY_END();
+}
+
+void loop() {
+
+}